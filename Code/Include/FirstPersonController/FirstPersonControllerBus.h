@@ -6,15 +6,114 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+#include <FirstPersonController/FirstPersonControllerComponentBus.h>
+#include <FirstPersonController/FirstPersonControllerMovementProfile.h>
 
 namespace FirstPersonController
 {
+    // Registry entry for an active First Person Controller, shared between the system component and any handles to it.
+    // Both pointers are cleared when the controller deactivates.
+    struct FirstPersonControllerRegistryEntry
+    {
+        FirstPersonControllerComponentRequests* m_requests = nullptr;
+        const FirstPersonControllerPublishedState* m_state = nullptr;
+
+        // Update tier and phase last assigned by the distance-based LOD, relevant controllers always run at full rate
+        AZ::u32 m_updateTier = 0;
+        AZ::u32 m_updatePhase = 0;
+        AZ::u32 m_nearestTier = 0;
+        bool m_relevant = false;
+
+        // Pooled controllers are left out of the spatial hash until they're acquired again
+        bool m_pooled = false;
+
+        // Location of the controller in the system component's spatial hash
+        AZ::u64 m_spatialHashCell = 0;
+        AZ::u32 m_spatialHashIndex = 0;
+        bool m_inSpatialHash = false;
+    };
+
+    // Typed handle to an active First Person Controller, obtained once and cached by C++ systems that
+    // read many controllers every frame. Calls through the handle bypass the EBus address lookup.
+    class FirstPersonControllerHandle
+    {
+    public:
+        FirstPersonControllerHandle() = default;
+        explicit FirstPersonControllerHandle(AZStd::shared_ptr<const FirstPersonControllerRegistryEntry> entry)
+            : m_entry(AZStd::move(entry))
+        {
+        }
+
+        // False once the controller has been deactivated
+        bool IsValid() const
+        {
+            return m_entry != nullptr && m_entry->m_requests != nullptr;
+        }
+
+        // Consistent copy of the controller's state from its most recent step, safe to call from any thread, only call when IsValid()
+        FirstPersonControllerState GetState() const
+        {
+            return m_entry->m_state->Read();
+        }
+
+        // Direct access to the controller's request interface, only call when IsValid()
+        FirstPersonControllerComponentRequests* GetRequests() const
+        {
+            return m_entry->m_requests;
+        }
+
+    private:
+        AZStd::shared_ptr<const FirstPersonControllerRegistryEntry> m_entry;
+    };
+
     class FirstPersonControllerRequests
     {
     public:
         AZ_RTTI(FirstPersonControllerRequests, "{2880DB3D-3966-4C87-8777-BC9028E3F48D}");
         virtual ~FirstPersonControllerRequests() = default;
-        // Put your public methods here
+
+        // Controller registry, controllers register themselves on activation and unregister on deactivation
+        virtual void RegisterController(const AZ::EntityId& entityId, FirstPersonControllerComponentRequests* requests, const FirstPersonControllerPublishedState* state) = 0;
+        virtual void UnregisterController(const AZ::EntityId& entityId) = 0;
+        virtual FirstPersonControllerHandle GetControllerHandle(const AZ::EntityId& entityId) const = 0;
+        virtual AZ::u32 GetControllerCount() const = 0;
+
+        // Shared movement profiles, loaded from the settings registry under MovementProfilesRegistryPath.
+        // Setting a profile replaces it and updates every active controller that references it by name.
+        virtual AZStd::shared_ptr<const FirstPersonControllerMovementProfile> GetMovementProfile(const AZStd::string& profileName) const = 0;
+        virtual void SetMovementProfile(const AZStd::string& profileName, const FirstPersonControllerMovementProfile& profile) = 0;
+        // Returns a shared profile equal to the given values, so that controllers without a named profile whose own
+        // values match share one copy
+        virtual AZStd::shared_ptr<const FirstPersonControllerMovementProfile> InternMovementProfile(const FirstPersonControllerMovementProfile& profile) = 0;
+
+        // Distance-based update LOD. Controllers run every step within the full rate distance of the nearest viewer,
+        // every 2nd step within the half rate distance, every 4th step within the quarter rate distance, and beyond that
+        // only keep themselves on the ground every 4th step. LOD is disabled while there are no viewers.
+        virtual void AddLodViewer(const AZ::EntityId& viewerEntityId) = 0;
+        virtual void RemoveLodViewer(const AZ::EntityId& viewerEntityId) = 0;
+        virtual void SetLodDistances(float fullRateDistance, float halfRateDistance, float quarterRateDistance) = 0;
+        virtual void SetControllerRelevant(const AZ::EntityId& entityId, bool relevant) = 0;
+
+        // Uniform grid spatial hash of the active controllers, refreshed each tick from the positions in their published state.
+        // The queries write up to maxResults entity IDs into results without allocating, and return the number of controllers
+        // found, which can exceed maxResults. The hash is updated on the main thread, so only query it from there.
+        virtual void SetSpatialHashCellSize(float cellSize) = 0;
+        virtual AZ::u32 QueryControllersInRadius(const AZ::Vector3& center, float radius, AZ::EntityId* results, AZ::u32 maxResults) const = 0;
+        // Also writes the position each controller had when the hash was last refreshed into positions, alongside its entity ID
+        virtual AZ::u32 QueryControllersInRadius(const AZ::Vector3& center, float radius, AZ::EntityId* results, AZ::Vector3* positions, AZ::u32 maxResults) const = 0;
+        virtual AZ::u32 QueryControllersInBox(const AZ::Aabb& box, AZ::EntityId* results, AZ::u32 maxResults) const = 0;
+
+        // Pool of controllers that stay activated between uses, so that respawning doesn't pay for activation.
+        // Releasing a controller resets its runtime state, stops its steps, disables its character's physics and parks it
+        // at parkPosition.
+        // Acquiring returns the most recently released controller teleported to position and heading, or an
+        // invalid EntityId when the pool is empty.
+        virtual void ReleaseControllerToPool(const AZ::EntityId& entityId, const AZ::Vector3& parkPosition) = 0;
+        virtual AZ::EntityId AcquirePooledController(const AZ::Vector3& position, float heading) = 0;
+        virtual AZ::u32 GetPooledControllerCount() const = 0;
     };
     
     class FirstPersonControllerBusTraits
@@ -7,11 +7,20 @@
 #include <AzCore/Component/ComponentBus.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/span.h>
+
+#include <FirstPersonController/FirstPersonControllerImpact.h>
+#include <FirstPersonController/FirstPersonControllerJumpPrediction.h>
+#include <FirstPersonController/FirstPersonControllerState.h>
 
 #include <AzFramework/Physics/PhysicsScene.h>
 
 namespace FirstPersonController
 {
+    // The per-field getters read the controller's live state, so they're only consistent with each other when called on the
+    // thread that runs the controller's step or from its notifications. From any other thread use GetStateSnapshot(), which
+    // returns the state published at the end of the last step as a whole. With Queue Setters enabled, the setters called
+    // from other threads take effect at the start of the next step.
     class FirstPersonControllerComponentRequests : public AZ::ComponentBus
     {
     public:
@@ -70,6 +79,13 @@ namespace FirstPersonController
         virtual void SetGroundedForTick(const bool&) = 0;
         virtual AZStd::vector<AzPhysics::SceneQueryHit> GetGroundSceneQueryHits() const = 0;
         virtual AZStd::vector<AzPhysics::SceneQueryHit> GetGroundCloseSceneQueryHits() const = 0;
+        // The views below do not copy and are only valid until the controller's next step
+        virtual AZStd::span<const AzPhysics::SceneQueryHit> GetGroundSceneQueryHitsView() const = 0;
+        virtual AZStd::span<const AzPhysics::SceneQueryHit> GetGroundCloseSceneQueryHitsView() const = 0;
+        virtual AZ::u32 GetGroundSceneQueryHitCount() const = 0;
+        virtual AzPhysics::SceneQueryHit GetGroundSceneQueryHitByIndex(const AZ::u32&) const = 0;
+        virtual AZ::u32 GetGroundCloseSceneQueryHitCount() const = 0;
+        virtual AzPhysics::SceneQueryHit GetGroundCloseSceneQueryHitByIndex(const AZ::u32&) const = 0;
         virtual AZ::Vector3 GetGroundSumNormalsDirection() const = 0;
         virtual AZ::Vector3 GetGroundCloseSumNormalsDirection() const = 0;
         virtual AZ::EntityId GetSceneQueryHitEntityId(AzPhysics::SceneQueryHit) const = 0;
@@ -118,6 +134,47 @@ namespace FirstPersonController
         virtual void SetAddVelocityForTimestepVsTick(const bool&) = 0;
         virtual float GetPhysicsTimestepScaleFactor() const = 0;
         virtual void SetPhysicsTimestepScaleFactor(const float&) = 0;
+        virtual bool GetFixedStepTick() const = 0;
+        virtual void SetFixedStepTick(const bool&) = 0;
+        virtual float GetFixedStepRate() const = 0;
+        virtual void SetFixedStepRate(const float&) = 0;
+        virtual AZ::u32 GetFixedStepMaxSubsteps() const = 0;
+        virtual void SetFixedStepMaxSubsteps(const AZ::u32&) = 0;
+        virtual bool GetGroundQueriesOncePerFrame() const = 0;
+        virtual void SetGroundQueriesOncePerFrame(const bool&) = 0;
+        virtual bool GetHeadQueryOncePerFrame() const = 0;
+        virtual void SetHeadQueryOncePerFrame(const bool&) = 0;
+        virtual bool GetStandQueryOncePerFrame() const = 0;
+        virtual void SetStandQueryOncePerFrame(const bool&) = 0;
+        virtual bool GetQueueSetters() const = 0;
+        virtual void SetQueueSetters(const bool&) = 0;
+        virtual bool GetQueueInput() const = 0;
+        virtual void SetQueueInput(const bool&) = 0;
+        virtual bool GetDeferNotifications() const = 0;
+        virtual void SetDeferNotifications(const bool&) = 0;
+        virtual bool GetNotificationsEdgeTriggered() const = 0;
+        virtual void SetNotificationsEdgeTriggered(const bool&) = 0;
+        virtual float GetNotificationMinInterval() const = 0;
+        virtual void SetNotificationMinInterval(const float&) = 0;
+        virtual bool GetSleepWhenIdle() const = 0;
+        virtual void SetSleepWhenIdle(const bool&) = 0;
+        virtual float GetSleepIdleDelay() const = 0;
+        virtual void SetSleepIdleDelay(const float&) = 0;
+        virtual bool GetSleeping() const = 0;
+        virtual void WakeUp() = 0;
+        virtual AZ::u32 GetUpdateTier() const = 0;
+        virtual void SetUpdateTier(const AZ::u32&, const AZ::u32&) = 0;
+        virtual bool GetCrowdSeparation() const = 0;
+        virtual void SetCrowdSeparation(const bool&) = 0;
+        virtual float GetSeparationRadius() const = 0;
+        virtual void SetSeparationRadius(const float&) = 0;
+        virtual float GetSeparationSpeed() const = 0;
+        virtual void SetSeparationSpeed(const float&) = 0;
+        virtual AZ::Vector2 GetSeparationVelocityXY() const = 0;
+        virtual void ResetRuntimeState() = 0;
+        virtual void Teleport(const AZ::Vector3&, const float&) = 0;
+        virtual bool GetPooled() const = 0;
+        virtual void SetPooled(const bool&) = 0;
         virtual bool GetScriptSetsTargetVelocityXY() const = 0;
         virtual void SetScriptSetsTargetVelocityXY(const bool&) = 0;
         virtual AZ::Vector2 GetTargetVelocityXY() const = 0;
@@ -148,8 +205,15 @@ namespace FirstPersonController
         virtual void SetGroundedOffset(const float&) = 0;
         virtual float GetGroundCloseOffset() const = 0;
         virtual void SetGroundCloseOffset(const float&) = 0;
+        virtual bool GetGroundCloseTimeToImpact() const = 0;
+        virtual void SetGroundCloseTimeToImpact(const bool&) = 0;
+        virtual float GetGroundCloseTimeThreshold() const = 0;
+        virtual void SetGroundCloseTimeThreshold(const float&) = 0;
+        virtual float GetTimeToGroundImpact() const = 0;
         virtual float GetJumpHoldDistance() const = 0;
         virtual void SetJumpHoldDistance(const float&) = 0;
+        virtual bool GetExactVelocityZ() const = 0;
+        virtual void SetExactVelocityZ(const bool&) = 0;
         virtual float GetJumpHeadSphereCastOffset() const = 0;
         virtual void SetJumpHeadSphereCastOffset(const float&) = 0;
         virtual bool GetHeadHitSetsApogee() const = 0;
@@ -162,6 +226,9 @@ namespace FirstPersonController
         virtual void SetHeadCollisionGroupByName(const AZStd::string&) = 0;
         virtual AzPhysics::SceneQuery::ResultFlags GetSceneQueryHitResultFlags(AzPhysics::SceneQueryHit) const = 0;
         virtual AZStd::vector<AZ::EntityId> GetHeadHitEntityIds() const = 0;
+        virtual AZStd::span<const AZ::EntityId> GetHeadHitEntityIdsView() const = 0;
+        virtual AZ::u32 GetHeadHitEntityIdCount() const = 0;
+        virtual AZ::EntityId GetHeadHitEntityIdByIndex(const AZ::u32&) const = 0;
         virtual bool GetStandPrevented() const = 0;
         virtual void SetStandPrevented(const bool&) = 0;
         virtual bool GetStandIgnoreDynamicRigidBodies() const = 0;
@@ -169,6 +236,9 @@ namespace FirstPersonController
         virtual AZStd::string GetStandCollisionGroupName() const = 0;
         virtual void SetStandCollisionGroupByName(const AZStd::string&) = 0;
         virtual AZStd::vector<AZ::EntityId> GetStandPreventedEntityIds() const = 0;
+        virtual AZStd::span<const AZ::EntityId> GetStandPreventedEntityIdsView() const = 0;
+        virtual AZ::u32 GetStandPreventedEntityIdCount() const = 0;
+        virtual AZ::EntityId GetStandPreventedEntityIdByIndex(const AZ::u32&) const = 0;
         virtual float GetGroundSphereCastsRadiusPercentageIncrease() const = 0;
         virtual void SetGroundSphereCastsRadiusPercentageIncrease(const float&) = 0;
         virtual float GetMaxGroundedAngleDegrees() const = 0;
@@ -190,6 +260,8 @@ namespace FirstPersonController
         virtual bool GetOpposingDecelFactorApplied() const = 0;
         virtual bool GetInstantVelocityRotation() const = 0;
         virtual void SetInstantVelocityRotation(const bool&) = 0;
+        virtual bool GetAnalyticVelocityXY() const = 0;
+        virtual void SetAnalyticVelocityXY(const bool&) = 0;
         virtual bool GetVelocityXYIgnoresObstacles() const = 0;
         virtual void SetVelocityXYIgnoresObstacles(const bool&) = 0;
         virtual bool GetGravityIgnoresObstacles() const = 0;
@@ -295,6 +367,23 @@ namespace FirstPersonController
         virtual float GetHeading() const = 0;
         virtual void SetHeadingForTick(const float&) = 0;
         virtual float GetPitch() const = 0;
+        virtual FirstPersonControllerState GetStateSnapshot() const = 0;
+        virtual AZStd::string GetMovementProfileName() const = 0;
+        virtual void SetMovementProfileName(const AZStd::string&) = 0;
+        virtual void ReapplyMovementProfile() = 0;
+        virtual void ClearMovementProfileOverrides() = 0;
+        virtual FirstPersonControllerJumpPrediction PredictJump(const float&, const float&, const float&) const = 0;
+        virtual bool TestJumpArc(const AZ::Vector3&, const AZ::Vector3&, const float&) const = 0;
+        virtual AZ::u32 AddPropertyThresholdWatch(const AZStd::string&, const float&) = 0;
+        virtual AZ::u32 AddPropertyDeltaWatch(const AZStd::string&, const float&) = 0;
+        virtual void RemovePropertyWatch(const AZ::u32&) = 0;
+        virtual void ClearPropertyWatches() = 0;
+        virtual void QueueMoveCommand(const float&, const float&, const float&) = 0;
+        virtual void QueueFaceCommand(const float&, const float&) = 0;
+        virtual void QueueJumpCommand(const float&, const float&) = 0;
+        virtual void QueueCrouchCommand(const float&) = 0;
+        virtual void ClearMovementCommands() = 0;
+        virtual AZ::u32 GetMovementCommandCount() const = 0;
     };
 
     using FirstPersonControllerComponentRequestBus = AZ::EBus<FirstPersonControllerComponentRequests>;
@@ -328,6 +417,19 @@ namespace FirstPersonController
         virtual void OnSprintStarted() = 0;
         virtual void OnCooldownStarted() = 0;
         virtual void OnCooldownDone() = 0;
+
+        // Variants of the contact notifications that carry the contact's details. They're sent after the plain
+        // notification of the same event and have empty default implementations so that existing handlers are unaffected.
+        virtual void OnGroundHitWithImpact([[maybe_unused]] const FirstPersonControllerImpact& impact) {}
+        virtual void OnHeadHitWithImpact([[maybe_unused]] const FirstPersonControllerImpact& impact) {}
+        virtual void OnHitSomethingWithImpact([[maybe_unused]] const FirstPersonControllerImpact& impact) {}
+        virtual void OnStandPreventedWithImpact([[maybe_unused]] const FirstPersonControllerImpact& impact) {}
+
+        // Sent when a property watch added through the request bus is triggered, with the property's new value
+        virtual void OnPropertyWatchTriggered([[maybe_unused]] const AZ::u32& watchId, [[maybe_unused]] const float& value) {}
+
+        // Sent when the last queued movement command has finished
+        virtual void OnMovementCommandsCompleted() {}
     };
 
     using FirstPersonControllerNotificationBus = AZ::EBus<FirstPersonControllerNotifications>;
@@ -339,7 +441,7 @@ namespace FirstPersonController
     public:
         AZ_EBUS_BEHAVIOR_BINDER(FirstPersonControllerNotificationHandler,
             "{b6d9e703-2c1b-4282-81a9-249123f3eee8}",
-            AZ::SystemAllocator, OnGroundHit, OnGroundSoonHit, OnUngrounded, OnStartedFalling, OnJumpApogeeReached, OnStartedMoving, OnTargetVelocityReached, OnStopped, OnTopWalkSpeedReached, OnTopSprintSpeedReached, OnHeadHit, OnHitSomething, OnGravityPrevented, OnCrouched, OnStoodUp, OnStandPrevented, OnStartedCrouching, OnStartedStanding, OnFirstJump, OnSecondJump, OnStaminaCapped, OnStaminaReachedZero, OnSprintStarted, OnCooldownStarted, OnCooldownDone);
+            AZ::SystemAllocator, OnGroundHit, OnGroundSoonHit, OnUngrounded, OnStartedFalling, OnJumpApogeeReached, OnStartedMoving, OnTargetVelocityReached, OnStopped, OnTopWalkSpeedReached, OnTopSprintSpeedReached, OnHeadHit, OnHitSomething, OnGravityPrevented, OnCrouched, OnStoodUp, OnStandPrevented, OnStartedCrouching, OnStartedStanding, OnFirstJump, OnSecondJump, OnStaminaCapped, OnStaminaReachedZero, OnSprintStarted, OnCooldownStarted, OnCooldownDone, OnGroundHitWithImpact, OnHeadHitWithImpact, OnHitSomethingWithImpact, OnStandPreventedWithImpact, OnPropertyWatchTriggered, OnMovementCommandsCompleted);
 
         void OnGroundHit() override
         {
@@ -441,5 +543,29 @@ namespace FirstPersonController
         {
             Call(FN_OnCooldownDone);
         }
+        void OnGroundHitWithImpact(const FirstPersonControllerImpact& impact) override
+        {
+            Call(FN_OnGroundHitWithImpact, impact);
+        }
+        void OnHeadHitWithImpact(const FirstPersonControllerImpact& impact) override
+        {
+            Call(FN_OnHeadHitWithImpact, impact);
+        }
+        void OnHitSomethingWithImpact(const FirstPersonControllerImpact& impact) override
+        {
+            Call(FN_OnHitSomethingWithImpact, impact);
+        }
+        void OnStandPreventedWithImpact(const FirstPersonControllerImpact& impact) override
+        {
+            Call(FN_OnStandPreventedWithImpact, impact);
+        }
+        void OnPropertyWatchTriggered(const AZ::u32& watchId, const float& value) override
+        {
+            Call(FN_OnPropertyWatchTriggered, watchId, value);
+        }
+        void OnMovementCommandsCompleted() override
+        {
+            Call(FN_OnMovementCommandsCompleted);
+        }
     };
 } // namespace FirstPersonController
@@ -0,0 +1,30 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/TypeInfo.h>
+
+#include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
+
+namespace FirstPersonController
+{
+    // Details of a contact, delivered with the impact notifications so that handlers don't need to query them afterwards.
+    // The entity is invalid when the contact wasn't found by a scene query, e.g. for a hit detected from a velocity change.
+    struct FirstPersonControllerImpact
+    {
+        AZ_TYPE_INFO(FirstPersonControllerImpact, "{5C1F4B7E-93A2-4D6B-8E0F-2A7D61C3B945}");
+
+        AZ::EntityId m_entityId;
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_normal = AZ::Vector3::CreateAxisZ();
+        // The character's world velocity going into the contact
+        AZ::Vector3 m_impactVelocity = AZ::Vector3::CreateZero();
+        Physics::MaterialId m_materialId;
+        // Time spent in the air before a landing, zero for the other contacts
+        float m_airTime = 0.f;
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,24 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/RTTI/TypeInfo.h>
+
+namespace FirstPersonController
+{
+    // Closed-form prediction of a jump from level ground using the controller's current jump and gravity settings.
+    // Heights are relative to the take-off height and the horizontal reach assumes a constant horizontal speed.
+    struct FirstPersonControllerJumpPrediction
+    {
+        AZ_TYPE_INFO(FirstPersonControllerJumpPrediction, "{8E0B7C55-21A4-4F0C-9E3B-6B0D3F52A1C7}");
+
+        // False when the settings can't produce a landing, e.g. when gravity isn't pulling the character down
+        bool m_valid = false;
+        float m_apexHeight = 0.f;
+        float m_timeToApex = 0.f;
+        float m_airTime = 0.f;
+        float m_horizontalReach = 0.f;
+    };
+} // namespace FirstPersonController
@@ -0,0 +1,100 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/string/string.h>
+
+namespace FirstPersonController
+{
+    // Settings registry path under which named movement profiles are defined
+    static constexpr const char* MovementProfilesRegistryPath = "/FirstPersonController/MovementProfiles";
+
+    // Movement tuning shared by every controller that references the profile by name, so that many controllers
+    // of the same archetype share one copy. Profiles are immutable once shared, a controller whose values are changed
+    // through the request bus gets its own copy. The defaults match the First Person Controller component's defaults.
+    struct FirstPersonControllerMovementProfile
+    {
+        AZ_TYPE_INFO(FirstPersonControllerMovementProfile, "{3AB25262-B41E-4F92-8FA4-55CF78388086}");
+
+        // Input event names
+        AZStd::string m_forwardEventName = "Forward";
+        AZStd::string m_backEventName = "Back";
+        AZStd::string m_leftEventName = "Left";
+        AZStd::string m_rightEventName = "Right";
+        AZStd::string m_yawEventName = "Yaw";
+        AZStd::string m_pitchEventName = "Pitch";
+        AZStd::string m_sprintEventName = "Sprint";
+        AZStd::string m_crouchEventName = "Crouch";
+        AZStd::string m_jumpEventName = "Jump";
+
+        // Collision group names, a controller keeps the collision group selected on its component when these are empty
+        AZStd::string m_groundedCollisionGroup;
+        AZStd::string m_jumpHeadCollisionGroup;
+        AZStd::string m_standCollisionGroup;
+
+        // X&Y movement
+        float m_topWalkSpeed = 5.f;
+        float m_walkAcceleration = 30.f;
+        float m_deceleration = 1.5f;
+        float m_opposingDeceleration = 2.f;
+
+        // Direction scale factors
+        float m_forwardScale = 1.f;
+        float m_backScale = 0.75f;
+        float m_leftScale = 1.f;
+        float m_rightScale = 1.f;
+
+        // Sprinting
+        float m_sprintScaleForward = 1.5f;
+        float m_sprintScaleBack = 1.f;
+        float m_sprintScaleLeft = 1.25f;
+        float m_sprintScaleRight = 1.25f;
+        float m_sprintAccelScale = 1.5f;
+        float m_sprintMaxTime = 120.f;
+        float m_sprintCooldownTime = 1.f;
+        float m_sprintRegenRate = 1.f;
+
+        // Crouching
+        float m_crouchScale = 0.5f;
+        float m_crouchDistance = 0.5f;
+        float m_crouchTime = 0.2f;
+        float m_standTime = 0.2f;
+
+        // Jumping and gravity
+        float m_gravity = -30.f;
+        float m_jumpInitialVelocity = 6.f;
+        float m_jumpSecondInitialVelocity = 6.f;
+        float m_jumpHeldGravityFactor = 0.1f;
+        float m_jumpFallingGravityFactor = 0.9f;
+        float m_jumpAccelFactor = 0.25f;
+        float m_jumpHoldDistance = 0.8f;
+
+        bool operator==(const FirstPersonControllerMovementProfile& rhs) const
+        {
+            return m_forwardEventName == rhs.m_forwardEventName && m_backEventName == rhs.m_backEventName
+                && m_leftEventName == rhs.m_leftEventName && m_rightEventName == rhs.m_rightEventName
+                && m_yawEventName == rhs.m_yawEventName && m_pitchEventName == rhs.m_pitchEventName
+                && m_sprintEventName == rhs.m_sprintEventName && m_crouchEventName == rhs.m_crouchEventName
+                && m_jumpEventName == rhs.m_jumpEventName
+                && m_groundedCollisionGroup == rhs.m_groundedCollisionGroup && m_jumpHeadCollisionGroup == rhs.m_jumpHeadCollisionGroup
+                && m_standCollisionGroup == rhs.m_standCollisionGroup
+                && m_topWalkSpeed == rhs.m_topWalkSpeed && m_walkAcceleration == rhs.m_walkAcceleration
+                && m_deceleration == rhs.m_deceleration && m_opposingDeceleration == rhs.m_opposingDeceleration
+                && m_forwardScale == rhs.m_forwardScale && m_backScale == rhs.m_backScale
+                && m_leftScale == rhs.m_leftScale && m_rightScale == rhs.m_rightScale
+                && m_sprintScaleForward == rhs.m_sprintScaleForward && m_sprintScaleBack == rhs.m_sprintScaleBack
+                && m_sprintScaleLeft == rhs.m_sprintScaleLeft && m_sprintScaleRight == rhs.m_sprintScaleRight
+                && m_sprintAccelScale == rhs.m_sprintAccelScale && m_sprintMaxTime == rhs.m_sprintMaxTime
+                && m_sprintCooldownTime == rhs.m_sprintCooldownTime && m_sprintRegenRate == rhs.m_sprintRegenRate
+                && m_crouchScale == rhs.m_crouchScale && m_crouchDistance == rhs.m_crouchDistance
+                && m_crouchTime == rhs.m_crouchTime && m_standTime == rhs.m_standTime
+                && m_gravity == rhs.m_gravity && m_jumpInitialVelocity == rhs.m_jumpInitialVelocity
+                && m_jumpSecondInitialVelocity == rhs.m_jumpSecondInitialVelocity
+                && m_jumpHeldGravityFactor == rhs.m_jumpHeldGravityFactor && m_jumpFallingGravityFactor == rhs.m_jumpFallingGravityFactor
+                && m_jumpAccelFactor == rhs.m_jumpAccelFactor && m_jumpHoldDistance == rhs.m_jumpHoldDistance;
+        }
+    };
+} // namespace FirstPersonController
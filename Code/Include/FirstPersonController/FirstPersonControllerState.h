@@ -0,0 +1,101 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace FirstPersonController
+{
+    // Snapshot of the controller's per-step state, filled once at the end of each step
+    // so that it can be retrieved with a single request instead of many individual getters
+    struct FirstPersonControllerState
+    {
+        AZ_TYPE_INFO(FirstPersonControllerState, "{29F1E32F-4027-4530-BC87-DE9EDC3BBF16}");
+
+        // Movement
+        AZ::Vector3 m_prevTargetVelocityWorld = AZ::Vector3::CreateZero();
+        AZ::Vector2 m_applyVelocityXY = AZ::Vector2::CreateZero();
+        float m_applyVelocityZ = 0.f;
+        bool m_accelerating = false;
+        bool m_hitSomething = false;
+        bool m_gravityPrevented = false;
+
+        // Grounded and jumping
+        float m_airTime = 0.f;
+        bool m_grounded = true;
+        bool m_groundClose = true;
+        bool m_jumpHeld = false;
+        bool m_secondJump = false;
+        bool m_headHit = false;
+
+        // Crouching
+        float m_crouchedPercentage = 0.f;
+        bool m_crouching = false;
+        bool m_crouched = false;
+        bool m_standing = true;
+        bool m_standPrevented = false;
+
+        // Sprinting and stamina
+        float m_staminaPercentage = 100.f;
+        float m_sprintCooldown = 0.f;
+        bool m_sprinting = false;
+        bool m_staminaIncreasing = false;
+        bool m_staminaDecreasing = false;
+
+        // Camera
+        float m_heading = 0.f;
+        float m_pitch = 0.f;
+
+        // World position of the character at the end of the step
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+    };
+
+    // Value published by one step and read on other threads, guarded by a sequence lock so that readers get a consistent
+    // copy without taking a lock. The sequence is odd while a write is in progress, readers retry if it was odd or changed
+    // while they copied. Writers are serialized on the sequence since both the tick and the physics simulation can publish.
+    template<typename T>
+    class SeqLockedValue
+    {
+    public:
+        void Publish(const T& value)
+        {
+            AZ::u32 sequence = m_sequence.load(AZStd::memory_order_relaxed);
+            do
+            {
+                while(sequence & 1u)
+                    sequence = m_sequence.load(AZStd::memory_order_relaxed);
+            } while(!m_sequence.compare_exchange_weak(sequence, sequence + 1, AZStd::memory_order_acquire, AZStd::memory_order_relaxed));
+
+            AZStd::atomic_thread_fence(AZStd::memory_order_release);
+            m_value = value;
+            m_sequence.store(sequence + 2, AZStd::memory_order_release);
+        }
+
+        T Read() const
+        {
+            for(;;)
+            {
+                const AZ::u32 sequence = m_sequence.load(AZStd::memory_order_acquire);
+                if(sequence & 1u)
+                    continue;
+
+                const T value = m_value;
+                AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+                if(m_sequence.load(AZStd::memory_order_relaxed) == sequence)
+                    return value;
+            }
+        }
+
+    private:
+        AZStd::atomic<AZ::u32> m_sequence = 0;
+        T m_value;
+    };
+
+    // Published copy of a controller's state from its most recently completed step
+    using FirstPersonControllerPublishedState = SeqLockedValue<FirstPersonControllerState>;
+} // namespace FirstPersonController
@@ -0,0 +1,137 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace FirstPersonController
+{
+    // Bounded lock-free queue that any number of threads may push to and pop from. Each slot carries a sequence number that
+    // tells producers and consumers whether the slot is free for the current lap around the ring, so neither side ever blocks.
+    // Capacity must be a power of two.
+    template<typename T, AZ::u32 Capacity>
+    class BoundedCommandQueue
+    {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "BoundedCommandQueue capacity must be a power of two");
+
+    public:
+        BoundedCommandQueue()
+        {
+            for(AZ::u32 i = 0; i < Capacity; ++i)
+                m_slots[i].m_sequence.store(i, AZStd::memory_order_relaxed);
+        }
+
+        BoundedCommandQueue(const BoundedCommandQueue&) = delete;
+        BoundedCommandQueue& operator=(const BoundedCommandQueue&) = delete;
+
+        // Returns false when the queue is full
+        bool Push(const T& value)
+        {
+            AZ::u32 position = m_pushPosition.load(AZStd::memory_order_relaxed);
+            for(;;)
+            {
+                Slot& slot = m_slots[position & (Capacity - 1)];
+                const AZ::u32 sequence = slot.m_sequence.load(AZStd::memory_order_acquire);
+                const AZ::s32 difference = static_cast<AZ::s32>(sequence - position);
+                if(difference == 0)
+                {
+                    if(m_pushPosition.compare_exchange_weak(position, position + 1, AZStd::memory_order_relaxed))
+                    {
+                        slot.m_value = value;
+                        slot.m_sequence.store(position + 1, AZStd::memory_order_release);
+                        return true;
+                    }
+                }
+                else if(difference < 0)
+                    return false;
+                else
+                    position = m_pushPosition.load(AZStd::memory_order_relaxed);
+            }
+        }
+
+        // Returns false when the queue is empty
+        bool Pop(T& value)
+        {
+            AZ::u32 position = m_popPosition.load(AZStd::memory_order_relaxed);
+            for(;;)
+            {
+                Slot& slot = m_slots[position & (Capacity - 1)];
+                const AZ::u32 sequence = slot.m_sequence.load(AZStd::memory_order_acquire);
+                const AZ::s32 difference = static_cast<AZ::s32>(sequence - (position + 1));
+                if(difference == 0)
+                {
+                    if(m_popPosition.compare_exchange_weak(position, position + 1, AZStd::memory_order_relaxed))
+                    {
+                        value = slot.m_value;
+                        slot.m_sequence.store(position + Capacity, AZStd::memory_order_release);
+                        return true;
+                    }
+                }
+                else if(difference < 0)
+                    return false;
+                else
+                    position = m_popPosition.load(AZStd::memory_order_relaxed);
+            }
+        }
+
+    private:
+        struct Slot
+        {
+            AZStd::atomic<AZ::u32> m_sequence;
+            T m_value;
+        };
+
+        Slot m_slots[Capacity];
+        // Producers and consumers touch different positions, keep them on separate cache lines
+        alignas(64) AZStd::atomic<AZ::u32> m_pushPosition = 0;
+        alignas(64) AZStd::atomic<AZ::u32> m_popPosition = 0;
+    };
+
+    // Bounded lock-free ring for exactly one producer thread and one consumer thread at a time. Commands are read in place
+    // with Front() so the consumer can leave a command in the ring until a later step. Capacity must be a power of two.
+    template<typename T, AZ::u32 Capacity>
+    class SpscCommandRing
+    {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "SpscCommandRing capacity must be a power of two");
+
+    public:
+        SpscCommandRing() = default;
+        SpscCommandRing(const SpscCommandRing&) = delete;
+        SpscCommandRing& operator=(const SpscCommandRing&) = delete;
+
+        // Producer only, returns false when the ring is full
+        bool Push(const T& value)
+        {
+            const AZ::u32 tail = m_tail.load(AZStd::memory_order_relaxed);
+            if(tail - m_head.load(AZStd::memory_order_acquire) == Capacity)
+                return false;
+
+            m_slots[tail & (Capacity - 1)] = value;
+            m_tail.store(tail + 1, AZStd::memory_order_release);
+            return true;
+        }
+
+        // Consumer only, returns nullptr when the ring is empty
+        const T* Front() const
+        {
+            const AZ::u32 head = m_head.load(AZStd::memory_order_relaxed);
+            if(head == m_tail.load(AZStd::memory_order_acquire))
+                return nullptr;
+            return &m_slots[head & (Capacity - 1)];
+        }
+
+        // Consumer only, only call after Front() returned a command
+        void PopFront()
+        {
+            m_head.store(m_head.load(AZStd::memory_order_relaxed) + 1, AZStd::memory_order_release);
+        }
+
+    private:
+        T m_slots[Capacity];
+        alignas(64) AZStd::atomic<AZ::u32> m_head = 0;
+        alignas(64) AZStd::atomic<AZ::u32> m_tail = 0;
+    };
+} // namespace FirstPersonController
@@ -3,11 +3,16 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include <Clients/FirstPersonControllerComponent.h>
+#include <Clients/FirstPersonControllerVelocityKernel.h>
+#include <Clients/FirstPersonControllerVerticalMotion.h>
 
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/utils.h>
 
 #include <AzFramework/Physics/RigidBodyBus.h>
 #include <AzFramework/Physics/CollisionBus.h>
@@ -24,10 +29,404 @@ namespace FirstPersonController
 {
     using namespace StartingPointInput;
 
+    FirstPersonControllerComponent::HotState::HotState()
+        : m_prevTargetVelocity(AZ::Vector3::CreateZero())
+        , m_prevPrevTargetVelocity(AZ::Vector3::CreateZero())
+        , m_applyVelocityXY(AZ::Vector2::CreateZero())
+        , m_prevTargetVelocityXY(AZ::Vector2::CreateZero())
+        , m_prevApplyVelocityXY(AZ::Vector2::CreateZero())
+        , m_correctedVelocityXY(AZ::Vector2::CreateZero())
+        , m_analyticVelocityXY(AZ::Vector2::CreateZero())
+        , m_applyVelocityZ(0.f)
+        , m_applyVelocityZCurrentDelta(0.f)
+        , m_applyVelocityZPrevDelta(0.f)
+        , m_correctedVelocityZ(0.f)
+        , m_lerpTime(0.f)
+        , m_totalLerpTime(0.f)
+        , m_decelerationFactor(1.5f)
+        , m_sprintAccelValue(1.f)
+        , m_sprintPrevValue(1.f)
+        , m_sprintVelocityAdjust(0.f)
+        , m_sprintAccelAdjust(0.f)
+        , m_sprintAccumulatedAccel(0.f)
+        , m_sprintPrevVelocityLength(0.f)
+        , m_sprintHeldDuration(0.f)
+        , m_crouchPrevValue(0.f)
+        , m_cameraLocalZTravelDistance(0.f)
+        , m_capsuleCurrentHeight(1.8f)
+        , m_timerClock(0.0)
+        , m_sprintHeldDurationTime(0.0)
+        , m_sprintPauseEnd(0.0)
+        , m_sprintCooldownEnd(0.0)
+        , m_airborneSince(0.0)
+        , m_jumpCounter(0.f)
+        , m_timeToGroundImpact(0.f)
+        , m_currentHeading(0.f)
+        , m_currentPitch(0.f)
+        , m_cameraRotationAngles{0.f, 0.f, 0.f}
+        , m_hitSomething(false)
+        , m_gravityPreventedFirstTick(false)
+        , m_gravityPrevented(false)
+        , m_staminaIncreasing(false)
+        , m_staminaDecreasing(false)
+        , m_sprintDraining(false)
+        , m_sprintCoolingDown(false)
+        , m_sprintStopAccelAdjustCaptured(false)
+        , m_crouching(false)
+        , m_crouched(false)
+        , m_standing(true)
+        , m_standPrevented(false)
+        , m_standPreventedViaScript(false)
+        , m_grounded(true)
+        , m_scriptGrounded(true)
+        , m_scriptSetGroundTick(false)
+        , m_groundClose(true)
+        , m_scriptGroundClose(true)
+        , m_scriptSetGroundCloseTick(false)
+        , m_jumpHeld(false)
+        , m_jumpReqRepress(true)
+        , m_secondJump(false)
+        , m_headHit(false)
+        , m_scriptSetcurrentHeadingTick(false)
+        , m_rotatingPitchViaScriptGamepad(false)
+        , m_rotatingYawViaScriptGamepad(false)
+        , m_accelerating(false)
+        , m_decelerationFactorApplied(false)
+        , m_opposingDecelFactorApplied(false)
+        , m_analyticVelocityRestart(true)
+    {
+    }
+
+    thread_local const FirstPersonControllerComponent* FirstPersonControllerComponent::s_steppingController = nullptr;
+
+    namespace
+    {
+        // Queued setter arguments are packed into a fixed number of floats, plus a string for the setters that take one,
+        // so that every command has the same size
+        template<typename T>
+        struct SetterArgument;
+        template<>
+        struct SetterArgument<float>
+        {
+            static constexpr size_t Size = 1;
+            static void Pack(float* values, AZStd::string&, const float& value)
+            {
+                values[0] = value;
+            }
+            static float Unpack(const float* values, const AZStd::string&)
+            {
+                return values[0];
+            }
+        };
+        template<>
+        struct SetterArgument<bool>
+        {
+            static constexpr size_t Size = 1;
+            static void Pack(float* values, AZStd::string&, const bool& value)
+            {
+                values[0] = value ? 1.f : 0.f;
+            }
+            static bool Unpack(const float* values, const AZStd::string&)
+            {
+                return values[0] != 0.f;
+            }
+        };
+        template<>
+        struct SetterArgument<AZ::u32>
+        {
+            // Stored by its bits, since a float can't represent every AZ::u32
+            static constexpr size_t Size = 1;
+            static void Pack(float* values, AZStd::string&, const AZ::u32& value)
+            {
+                memcpy(values, &value, sizeof(value));
+            }
+            static AZ::u32 Unpack(const float* values, const AZStd::string&)
+            {
+                AZ::u32 value;
+                memcpy(&value, values, sizeof(value));
+                return value;
+            }
+        };
+        template<>
+        struct SetterArgument<AZ::Vector2>
+        {
+            static constexpr size_t Size = 2;
+            static void Pack(float* values, AZStd::string&, const AZ::Vector2& value)
+            {
+                values[0] = value.GetX();
+                values[1] = value.GetY();
+            }
+            static AZ::Vector2 Unpack(const float* values, const AZStd::string&)
+            {
+                return AZ::Vector2(values[0], values[1]);
+            }
+        };
+        template<>
+        struct SetterArgument<AZ::Vector3>
+        {
+            static constexpr size_t Size = 3;
+            static void Pack(float* values, AZStd::string&, const AZ::Vector3& value)
+            {
+                value.StoreToFloat3(values);
+            }
+            static AZ::Vector3 Unpack(const float* values, const AZStd::string&)
+            {
+                return AZ::Vector3::CreateFromFloat3(values);
+            }
+        };
+        template<>
+        struct SetterArgument<AZStd::string>
+        {
+            static constexpr size_t Size = 0;
+            static void Pack(float*, AZStd::string& string, const AZStd::string& value)
+            {
+                string = value;
+            }
+            static const AZStd::string& Unpack(const float*, const AZStd::string& string)
+            {
+                return string;
+            }
+        };
+
+        // Offset of the argument at index within the packed values
+        template<typename... Args>
+        constexpr size_t SetterArgumentOffset(const size_t index)
+        {
+            constexpr size_t sizes[] = { SetterArgument<Args>::Size..., 0 };
+            size_t offset = 0;
+            for(size_t i = 0; i < index; ++i)
+                offset += sizes[i];
+            return offset;
+        }
+
+        template<auto Setter, typename... Args, size_t... Indices>
+        void ApplyQueuedSetterArguments(FirstPersonControllerComponent& controller, const float* values, const AZStd::string& string,
+            AZStd::index_sequence<Indices...>)
+        {
+            (controller.*Setter)(SetterArgument<Args>::Unpack(values + SetterArgumentOffset<Args...>(Indices), string)...);
+        }
+    } // namespace
+
+    // Returns true when the call was queued and the setter should return without applying it
+    template<auto Setter, bool Wake, typename... Args>
+    bool FirstPersonControllerComponent::QueueSetter(const Args&... args)
+    {
+        static_assert((size_t(0) + ... + SetterArgument<Args>::Size) <= QueuedSetter::MaxValues,
+            "The arguments of a queued setter must fit in QueuedSetter::m_values");
+
+        if(s_steppingController == this || m_pooled)
+            return false;
+
+        if constexpr(Wake)
+            WakeForRequest();
+
+        if(!m_queueSetters)
+            return false;
+
+        QueuedSetter queuedSetter;
+        queuedSetter.m_apply = [](FirstPersonControllerComponent& controller, const QueuedSetter& queued)
+        {
+            ApplyQueuedSetterArguments<Setter, Args...>(controller, queued.m_values, queued.m_string, AZStd::index_sequence_for<Args...>{});
+        };
+        size_t offset = 0;
+        ((SetterArgument<Args>::Pack(queuedSetter.m_values + offset, queuedSetter.m_string, args), offset += SetterArgument<Args>::Size), ...);
+
+        if(!m_queuedSetters.Push(queuedSetter))
+            AZ_Warning("First Person Controller Component", false, "The queue of setters awaiting the next step is full, the setter call was dropped.");
+
+        return true;
+    }
+
+    // A request made from outside of the step is a change that the character needs to respond to
+    void FirstPersonControllerComponent::WakeForRequest()
+    {
+        if(s_steppingController != this && m_sleeping.load(AZStd::memory_order_relaxed))
+            WakeUp();
+    }
+
+    void FirstPersonControllerComponent::ApplyQueuedSetters()
+    {
+        QueuedSetter queuedSetter;
+        while(m_queuedSetters.Pop(queuedSetter))
+            queuedSetter.m_apply(*this, queuedSetter);
+    }
+
+    namespace
+    {
+        // Indexed by FirstPersonControllerComponent::NotificationEvent
+        void (FirstPersonControllerNotifications::* const NotificationHandlers[])() = {
+            &FirstPersonControllerNotifications::OnGroundHit,
+            &FirstPersonControllerNotifications::OnGroundSoonHit,
+            &FirstPersonControllerNotifications::OnUngrounded,
+            &FirstPersonControllerNotifications::OnStartedFalling,
+            &FirstPersonControllerNotifications::OnJumpApogeeReached,
+            &FirstPersonControllerNotifications::OnStartedMoving,
+            &FirstPersonControllerNotifications::OnTargetVelocityReached,
+            &FirstPersonControllerNotifications::OnStopped,
+            &FirstPersonControllerNotifications::OnTopWalkSpeedReached,
+            &FirstPersonControllerNotifications::OnTopSprintSpeedReached,
+            &FirstPersonControllerNotifications::OnHeadHit,
+            &FirstPersonControllerNotifications::OnHitSomething,
+            &FirstPersonControllerNotifications::OnGravityPrevented,
+            &FirstPersonControllerNotifications::OnCrouched,
+            &FirstPersonControllerNotifications::OnStoodUp,
+            &FirstPersonControllerNotifications::OnStandPrevented,
+            &FirstPersonControllerNotifications::OnStartedCrouching,
+            &FirstPersonControllerNotifications::OnStartedStanding,
+            &FirstPersonControllerNotifications::OnFirstJump,
+            &FirstPersonControllerNotifications::OnSecondJump,
+            &FirstPersonControllerNotifications::OnStaminaCapped,
+            &FirstPersonControllerNotifications::OnStaminaReachedZero,
+            &FirstPersonControllerNotifications::OnSprintStarted,
+            &FirstPersonControllerNotifications::OnCooldownStarted,
+            &FirstPersonControllerNotifications::OnCooldownDone,
+        };
+
+        // Indexed by FirstPersonControllerComponent::NotificationEvent, starting at FirstImpactNotification
+        void (FirstPersonControllerNotifications::* const ImpactNotificationHandlers[])(const FirstPersonControllerImpact&) = {
+            &FirstPersonControllerNotifications::OnGroundHitWithImpact,
+            &FirstPersonControllerNotifications::OnHeadHitWithImpact,
+            &FirstPersonControllerNotifications::OnHitSomethingWithImpact,
+            &FirstPersonControllerNotifications::OnStandPreventedWithImpact,
+        };
+
+        FirstPersonControllerImpact CreateImpact(const AzPhysics::SceneQueryHit& hit, const AZ::Vector3& impactVelocity)
+        {
+            FirstPersonControllerImpact impact;
+            impact.m_entityId = hit.m_entityId;
+            impact.m_position = hit.m_position;
+            impact.m_normal = hit.m_normal;
+            impact.m_impactVelocity = impactVelocity;
+            impact.m_materialId = hit.m_physicsMaterialId;
+            return impact;
+        }
+
+        const AzPhysics::SceneQueryHit* FindNearestHit(const AZStd::vector<AzPhysics::SceneQueryHit>& hits)
+        {
+            const AzPhysics::SceneQueryHit* nearest = nullptr;
+            for(const AzPhysics::SceneQueryHit& hit: hits)
+                if(nearest == nullptr || hit.m_distance < nearest->m_distance)
+                    nearest = &hit;
+            return nearest;
+        }
+    } // namespace
+
+    void FirstPersonControllerComponent::Notify(NotificationEvent event)
+    {
+        if(!m_deferNotifications)
+        {
+            FirstPersonControllerNotificationBus::Broadcast(NotificationHandlers[static_cast<AZ::u32>(event)]);
+            return;
+        }
+
+        // Repeats of an event within the same flush period coalesce into a single bit
+        m_pendingNotifications.fetch_or(1u << static_cast<AZ::u32>(event), AZStd::memory_order_relaxed);
+    }
+
+    void FirstPersonControllerComponent::NotifyImpact(NotificationEvent event, const FirstPersonControllerImpact& impact)
+    {
+        const AZ::u32 index = static_cast<AZ::u32>(event);
+        // Impact payloads belong to this character, so they're only sent to the handlers connected to its entity
+        if(!m_deferNotifications)
+        {
+            FirstPersonControllerNotificationBus::Event(GetEntityId(), ImpactNotificationHandlers[index - FirstImpactNotification], impact);
+            return;
+        }
+
+        // The payload is published before its bit so that the flush always finds it
+        m_pendingImpacts[index - FirstImpactNotification].Publish(impact);
+        m_pendingNotifications.fetch_or(1u << index, AZStd::memory_order_release);
+    }
+
+    // Broadcasts the notifications recorded since the previous flush, called on the game thread after each tick's step.
+    // In edge-triggered mode an event only fires when it wasn't pending on the previous flush that followed a step,
+    // and with a minimum interval an event is dropped if it already fired within that interval.
+    void FirstPersonControllerComponent::FlushNotifications(const float& deltaTime)
+    {
+        m_notificationClock += deltaTime;
+
+        const AZ::u32 stepCount = m_notificationStepCount.load(AZStd::memory_order_acquire);
+        AZ::u32 pending = m_pendingNotifications.exchange(0, AZStd::memory_order_acquire);
+        if(pending == 0 && stepCount == m_notificationFlushedStepCount)
+            return;
+        m_notificationFlushedStepCount = stepCount;
+
+        if(m_notificationsEdgeTriggered)
+        {
+            const AZ::u32 raised = pending;
+            pending &= ~m_prevFlushedNotifications;
+            m_prevFlushedNotifications = raised;
+        }
+
+        for(AZ::u32 index = 0; pending != 0; ++index, pending >>= 1)
+        {
+            if(!(pending & 1u))
+                continue;
+
+            if(m_notificationMinInterval > 0.f)
+            {
+                if(m_notificationLastTimes[index] > 0.f && m_notificationClock - m_notificationLastTimes[index] < m_notificationMinInterval)
+                    continue;
+                m_notificationLastTimes[index] = m_notificationClock;
+            }
+
+            if(index < FirstImpactNotification)
+                FirstPersonControllerNotificationBus::Broadcast(NotificationHandlers[index]);
+            else
+                FirstPersonControllerNotificationBus::Event(GetEntityId(), ImpactNotificationHandlers[index - FirstImpactNotification],
+                    m_pendingImpacts[index - FirstImpactNotification].Read());
+        }
+    }
+
     void FirstPersonControllerComponent::Reflect(AZ::ReflectContext* rc)
     {
         if(auto sc = azrtti_cast<AZ::SerializeContext*>(rc))
         {
+            sc->Class<FirstPersonControllerState>()
+              ->Field("Previous Target Velocity World", &FirstPersonControllerState::m_prevTargetVelocityWorld)
+              ->Field("Apply Velocity XY", &FirstPersonControllerState::m_applyVelocityXY)
+              ->Field("Apply Velocity Z", &FirstPersonControllerState::m_applyVelocityZ)
+              ->Field("Accelerating", &FirstPersonControllerState::m_accelerating)
+              ->Field("Hit Something", &FirstPersonControllerState::m_hitSomething)
+              ->Field("Gravity Prevented", &FirstPersonControllerState::m_gravityPrevented)
+              ->Field("Air Time", &FirstPersonControllerState::m_airTime)
+              ->Field("Grounded", &FirstPersonControllerState::m_grounded)
+              ->Field("Ground Close", &FirstPersonControllerState::m_groundClose)
+              ->Field("Jump Held", &FirstPersonControllerState::m_jumpHeld)
+              ->Field("Second Jump", &FirstPersonControllerState::m_secondJump)
+              ->Field("Head Hit", &FirstPersonControllerState::m_headHit)
+              ->Field("Crouched Percentage", &FirstPersonControllerState::m_crouchedPercentage)
+              ->Field("Crouching", &FirstPersonControllerState::m_crouching)
+              ->Field("Crouched", &FirstPersonControllerState::m_crouched)
+              ->Field("Standing", &FirstPersonControllerState::m_standing)
+              ->Field("Stand Prevented", &FirstPersonControllerState::m_standPrevented)
+              ->Field("Stamina Percentage", &FirstPersonControllerState::m_staminaPercentage)
+              ->Field("Sprint Cooldown", &FirstPersonControllerState::m_sprintCooldown)
+              ->Field("Sprinting", &FirstPersonControllerState::m_sprinting)
+              ->Field("Stamina Increasing", &FirstPersonControllerState::m_staminaIncreasing)
+              ->Field("Stamina Decreasing", &FirstPersonControllerState::m_staminaDecreasing)
+              ->Field("Heading", &FirstPersonControllerState::m_heading)
+              ->Field("Pitch", &FirstPersonControllerState::m_pitch)
+              ->Field("Position", &FirstPersonControllerState::m_position)
+              ->Version(2);
+
+            sc->Class<FirstPersonControllerJumpPrediction>()
+              ->Field("Valid", &FirstPersonControllerJumpPrediction::m_valid)
+              ->Field("Apex Height", &FirstPersonControllerJumpPrediction::m_apexHeight)
+              ->Field("Time To Apex", &FirstPersonControllerJumpPrediction::m_timeToApex)
+              ->Field("Air Time", &FirstPersonControllerJumpPrediction::m_airTime)
+              ->Field("Horizontal Reach", &FirstPersonControllerJumpPrediction::m_horizontalReach)
+              ->Version(1);
+
+            sc->Class<FirstPersonControllerImpact>()
+              ->Field("EntityId", &FirstPersonControllerImpact::m_entityId)
+              ->Field("Position", &FirstPersonControllerImpact::m_position)
+              ->Field("Normal", &FirstPersonControllerImpact::m_normal)
+              ->Field("Impact Velocity", &FirstPersonControllerImpact::m_impactVelocity)
+              ->Field("MaterialId", &FirstPersonControllerImpact::m_materialId)
+              ->Field("Air Time", &FirstPersonControllerImpact::m_airTime)
+              ->Version(1);
+
             sc->Class<FirstPersonControllerComponent, AZ::Component>()
               // Input Bindings group
               ->Field("Forward Key", &FirstPersonControllerComponent::m_strForward)
@@ -58,8 +457,25 @@ namespace FirstPersonController
               ->Field("Deceleration Factor", &FirstPersonControllerComponent::m_decel)
               ->Field("Opposing Direction Deceleration Factor", &FirstPersonControllerComponent::m_opposingDecel)
               ->Field("Add Velocity For Physics Timestep Instead Of Tick", &FirstPersonControllerComponent::m_addVelocityForTimestepVsTick)
+              ->Field("Fixed Step In Tick Mode", &FirstPersonControllerComponent::m_fixedStepTick)
+              ->Field("Fixed Step Rate (Hz)", &FirstPersonControllerComponent::m_fixedStepRate)
+              ->Field("Fixed Step Max Substeps", &FirstPersonControllerComponent::m_fixedStepMaxSubsteps)
+              ->Field("Ground Queries Once Per Frame", &FirstPersonControllerComponent::m_groundQueriesOncePerFrame)
+              ->Field("Head Hit Query Once Per Frame", &FirstPersonControllerComponent::m_headQueryOncePerFrame)
+              ->Field("Stand Query Once Per Frame", &FirstPersonControllerComponent::m_standQueryOncePerFrame)
+              ->Field("Queue Setters From Other Threads", &FirstPersonControllerComponent::m_queueSetters)
+              ->Field("Queue Input", &FirstPersonControllerComponent::m_queueInput)
+              ->Field("Defer Notifications", &FirstPersonControllerComponent::m_deferNotifications)
+              ->Field("Edge-Triggered Notifications", &FirstPersonControllerComponent::m_notificationsEdgeTriggered)
+              ->Field("Notification Min Interval (s)", &FirstPersonControllerComponent::m_notificationMinInterval)
+              ->Field("Sleep When Idle", &FirstPersonControllerComponent::m_sleepWhenIdle)
+              ->Field("Sleep Idle Delay (s)", &FirstPersonControllerComponent::m_sleepIdleDelay)
+              ->Field("Crowd Separation", &FirstPersonControllerComponent::m_crowdSeparation)
+              ->Field("Separation Radius (m)", &FirstPersonControllerComponent::m_separationRadius)
+              ->Field("Separation Speed (m/s)", &FirstPersonControllerComponent::m_separationSpeed)
               ->Field("X&Y Movement Tracks Surface Inclines", &FirstPersonControllerComponent::m_velocityXCrossYTracksNormal)
               ->Field("Instant Velocity Rotation", &FirstPersonControllerComponent::m_instantVelocityRotation)
+              ->Field("Analytic Velocity Model", &FirstPersonControllerComponent::m_analyticVelocityXY)
 
               // Sprinting group
               ->Field("Sprint Forward Scale", &FirstPersonControllerComponent::m_sprintScaleForward)
@@ -96,7 +512,10 @@ namespace FirstPersonController
                 ->Attribute(AZ::Edit::Attributes::Suffix, "%")
               ->Field("Grounded Offset (m)", &FirstPersonControllerComponent::m_groundedSphereCastOffset)
               ->Field("Ground Close Offset (m)", &FirstPersonControllerComponent::m_groundCloseSphereCastOffset)
+              ->Field("Ground Close Uses Time To Impact", &FirstPersonControllerComponent::m_groundCloseTimeToImpact)
+              ->Field("Ground Close Time To Impact (sec)", &FirstPersonControllerComponent::m_groundCloseTimeThreshold)
               ->Field("Jump Hold Distance (m)", &FirstPersonControllerComponent::m_jumpHoldDistance)
+              ->Field("Exact Jump And Gravity Integration", &FirstPersonControllerComponent::m_exactVelocityZ)
               ->Field("Jump Head Hit Detection Distance (m)", &FirstPersonControllerComponent::m_jumpHeadSphereCastOffset)
               ->Field("Jump Head Hit Sets Apogee", &FirstPersonControllerComponent::m_headHitSetsApogee)
               ->Field("Jump Head Hit Ignore Dynamic Rigid Bodies", &FirstPersonControllerComponent::m_jumpHeadIgnoreDynamicRigidBodies)
@@ -105,6 +524,9 @@ namespace FirstPersonController
               ->Field("Update X&Y Velocity When Descending", &FirstPersonControllerComponent::m_updateXYDescending)
               ->Field("Update X&Y Velocity Only When Ground Close", &FirstPersonControllerComponent::m_updateXYOnlyNearGround)
 
+              // Movement Profile group
+              ->Field("Movement Profile", &FirstPersonControllerComponent::m_movementProfileName)
+
               ->Version(1);
 
             if(AZ::EditContext* ec = sc->GetEditContext())
@@ -179,12 +601,69 @@ namespace FirstPersonController
                     ->DataElement(nullptr,
                         &FirstPersonControllerComponent::m_addVelocityForTimestepVsTick,
                         "Add Velocity For Physics Timestep Instead Of Tick", "If this is enabled then the velocity will be applied on each physics timestep, if it is disabled then the velocity will be applied on each tick (frame).")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_fixedStepTick,
+                        "Fixed Step In Tick Mode", "If this is enabled while the velocity is applied on each tick, then the movement is simulated at Fixed Step Rate regardless of the frame rate, running as many steps per frame as are due. The velocity applied on each frame is interpolated between the last two steps.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_fixedStepRate,
+                        "Fixed Step Rate (Hz)", "The rate at which the movement is simulated when Fixed Step In Tick Mode is enabled.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 1.f)
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_fixedStepMaxSubsteps,
+                        "Fixed Step Max Substeps", "The maximum number of steps simulated on a single frame when Fixed Step In Tick Mode is enabled. Any further accumulated time is dropped so that a long frame can't cause a spiral of ever longer frames.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_groundQueriesOncePerFrame,
+                        "Ground Queries Once Per Frame", "If this is enabled then the ground sphere casts are made only on the first step of each frame, and later physics substeps or fixed steps within the same frame reuse their results.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_headQueryOncePerFrame,
+                        "Head Hit Query Once Per Frame", "If this is enabled then the jump head hit sphere cast is made only on the first step of each frame, and later steps within the same frame reuse its result.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_standQueryOncePerFrame,
+                        "Stand Query Once Per Frame", "If this is enabled then the sphere cast that checks for room to stand up is made at most once per frame, and later steps within the same frame reuse its result.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_queueSetters,
+                        "Queue Setters From Other Threads", "If this is enabled then setters that change the character's movement or runtime state, when called from outside of the character's own step, are queued and applied at the start of the next step. Use this when the physics simulation runs on a worker thread while scripts call the setters on the main thread.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_queueInput,
+                        "Queue Input", "If this is enabled then input events are recorded as timestamped commands and applied together at the start of the next step, so that each step sees a complete set of inputs regardless of the thread the input arrives on. If it is disabled then input events are applied as soon as they arrive.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_deferNotifications,
+                        "Defer Notifications", "If this is enabled then notifications raised during a step are recorded and broadcast together on the game thread after the tick, with repeats of the same event coalesced into one. If it is disabled then each notification is broadcast as soon as it's raised, possibly from the physics simulation.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_notificationsEdgeTriggered,
+                        "Edge-Triggered Notifications", "If this is enabled along with Defer Notifications then a notification is only broadcast when it wasn't also raised before the previous flush, so that conditions like being under a ceiling or pressing into a wall notify once instead of every tick.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_notificationMinInterval,
+                        "Notification Min Interval (s)", "When Defer Notifications is enabled, the minimum time between two broadcasts of the same notification. Raises within the interval are dropped. Set to 0 to disable.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_sleepWhenIdle,
+                        "Sleep When Idle", "If this is enabled then a character that is grounded on a static body, isn't moving and has no input or queued commands goes to sleep and skips its per-step work. It wakes on input, on a setter or movement command, when Wake Up is called, or when it or the body it's standing on is moved.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_sleepIdleDelay,
+                        "Sleep Idle Delay (s)", "How long the character needs to be idle before it goes to sleep.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_crowdSeparation,
+                        "Crowd Separation", "If this is enabled then the character steers away from other First Person Controllers within the separation radius, so that dense crowds flow past each other instead of relying on collisions between their character controllers.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_separationRadius,
+                        "Separation Radius (m)", "Distance within which other controllers steer the character away. This should be somewhat larger than the sum of two capsule radii so that the steering starts before the capsules touch.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_separationSpeed,
+                        "Separation Speed (m/s)", "The largest speed that separation adds to the character's X&Y velocity. Each nearby controller contributes more the closer it is.")
+                        ->Attribute(AZ::Edit::Attributes::Min, 0.f)
                     ->DataElement(nullptr,
                         &FirstPersonControllerComponent::m_velocityXCrossYTracksNormal,
                         "X&Y Movement Tracks Surface Inclines", "Determines whether the character's X&Y movement will be tilted in order to follow inclines. This will apply up to the max angle that is specified in the PhysX Character Controller component.")
                     ->DataElement(nullptr,
                         &FirstPersonControllerComponent::m_instantVelocityRotation,
                         "Instant Velocity Rotation", "Determines whether the velocity vector can rotate instantaneously with respect to the world coordinate system, if set to false then the acceleration and deceleration will apply when rotating the character.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_analyticVelocityXY,
+                        "Analytic Velocity Model", "If this is enabled then the X&Y velocity is moved toward the target velocity at a bounded rate in a single pass on each step, which gives the same top speeds and times to reach them as the default model while being independent of the step rate.")
 
                     ->ClassElement(AZ::Edit::ClassElements::Group, "Direction Scale Factors")
                     ->Attribute(AZ::Edit::Attributes::AutoExpand, false)
@@ -290,12 +769,21 @@ namespace FirstPersonController
                     ->DataElement(nullptr,
                         &FirstPersonControllerComponent::m_jumpHoldDistance,
                         "Jump Hold Distance (m)", "Effectively determines the time that jump may be held. During this initial period of the jump, the Jump Held Gravity Factor is applied, making the maximum height greater. If the number entered here exceeds the calculated apogee, you will get a warning message.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_exactVelocityZ,
+                        "Exact Jump And Gravity Integration", "If this is enabled then the held jump, normal, and falling gravity phases are integrated exactly within each step, so the jump apogee and air time are the same at any step rate.")
                     ->DataElement(nullptr,
                         &FirstPersonControllerComponent::m_groundedSphereCastOffset,
                         "Grounded Offset (m)", "Determines the offset distance between the bottom of the character and ground.")
                     ->DataElement(nullptr,
                         &FirstPersonControllerComponent::m_groundCloseSphereCastOffset,
                         "Ground Close Offset (m)", "Determines the offset distance between the bottom of the character and ground.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_groundCloseTimeToImpact,
+                        "Ground Close Uses Time To Impact", "If this is enabled then the ground is considered close when the predicted time until the character lands on it is within Ground Close Time To Impact, instead of using Ground Close Offset. A single ground sphere cast is made whose length is scaled by the fall speed.")
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_groundCloseTimeThreshold,
+                        "Ground Close Time To Impact (sec)", "The predicted time to landing below which the ground is considered close when Ground Close Uses Time To Impact is enabled.")
                     ->DataElement(nullptr,
                         &FirstPersonControllerComponent::m_groundSphereCastsRadiusPercentageIncrease,
                         "Ground Sphere Casts' Radius Percentage Increase (%)", "The percentage increase in the radius of the ground and ground close sphere casts over the PhysX Character Controller's capsule radius.")
@@ -319,7 +807,13 @@ namespace FirstPersonController
                         "Update X&Y Velocity When Descending", "Allows movement in X&Y during a jump’s descent.")
                     ->DataElement(nullptr,
                         &FirstPersonControllerComponent::m_updateXYOnlyNearGround,
-                        "Update X&Y Velocity Only When Ground Close", "Allows movement in X&Y only if close to an acceptable ground entity. According to the distance set in Jump Hold Distance. If the ascending and descending options are disabled, then this will effectively do nothing.");
+                        "Update X&Y Velocity Only When Ground Close", "Allows movement in X&Y only if close to an acceptable ground entity. According to the distance set in Jump Hold Distance. If the ascending and descending options are disabled, then this will effectively do nothing.")
+
+                    ->ClassElement(AZ::Edit::ClassElements::Group, "Movement Profile")
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, false)
+                    ->DataElement(nullptr,
+                        &FirstPersonControllerComponent::m_movementProfileName,
+                        "Movement Profile", "Name of a shared movement profile defined under /FirstPersonController/MovementProfiles in the settings registry. When set, the profile's movement, sprint, crouch and jump values replace this controller's values, except for those later changed on this controller through the request bus. Leave empty to use this controller's own values.");
             }
         }
 
@@ -328,6 +822,57 @@ namespace FirstPersonController
             bc->EBus<FirstPersonControllerNotificationBus>("FirstPersonNotificationBus")
                 ->Handler<FirstPersonControllerNotificationHandler>();
 
+            bc->Class<FirstPersonControllerState>("FirstPersonControllerState")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "controller")
+                ->Attribute(AZ::Script::Attributes::Category, "First Person Controller")
+                ->Property("Previous Target Velocity World", BehaviorValueProperty(&FirstPersonControllerState::m_prevTargetVelocityWorld))
+                ->Property("Apply Velocity XY", BehaviorValueProperty(&FirstPersonControllerState::m_applyVelocityXY))
+                ->Property("Apply Velocity Z", BehaviorValueProperty(&FirstPersonControllerState::m_applyVelocityZ))
+                ->Property("Accelerating", BehaviorValueProperty(&FirstPersonControllerState::m_accelerating))
+                ->Property("Hit Something", BehaviorValueProperty(&FirstPersonControllerState::m_hitSomething))
+                ->Property("Gravity Prevented", BehaviorValueProperty(&FirstPersonControllerState::m_gravityPrevented))
+                ->Property("Air Time", BehaviorValueProperty(&FirstPersonControllerState::m_airTime))
+                ->Property("Grounded", BehaviorValueProperty(&FirstPersonControllerState::m_grounded))
+                ->Property("Ground Close", BehaviorValueProperty(&FirstPersonControllerState::m_groundClose))
+                ->Property("Jump Held", BehaviorValueProperty(&FirstPersonControllerState::m_jumpHeld))
+                ->Property("Second Jump", BehaviorValueProperty(&FirstPersonControllerState::m_secondJump))
+                ->Property("Head Hit", BehaviorValueProperty(&FirstPersonControllerState::m_headHit))
+                ->Property("Crouched Percentage", BehaviorValueProperty(&FirstPersonControllerState::m_crouchedPercentage))
+                ->Property("Crouching", BehaviorValueProperty(&FirstPersonControllerState::m_crouching))
+                ->Property("Crouched", BehaviorValueProperty(&FirstPersonControllerState::m_crouched))
+                ->Property("Standing", BehaviorValueProperty(&FirstPersonControllerState::m_standing))
+                ->Property("Stand Prevented", BehaviorValueProperty(&FirstPersonControllerState::m_standPrevented))
+                ->Property("Stamina Percentage", BehaviorValueProperty(&FirstPersonControllerState::m_staminaPercentage))
+                ->Property("Sprint Cooldown", BehaviorValueProperty(&FirstPersonControllerState::m_sprintCooldown))
+                ->Property("Sprinting", BehaviorValueProperty(&FirstPersonControllerState::m_sprinting))
+                ->Property("Stamina Increasing", BehaviorValueProperty(&FirstPersonControllerState::m_staminaIncreasing))
+                ->Property("Stamina Decreasing", BehaviorValueProperty(&FirstPersonControllerState::m_staminaDecreasing))
+                ->Property("Heading", BehaviorValueProperty(&FirstPersonControllerState::m_heading))
+                ->Property("Pitch", BehaviorValueProperty(&FirstPersonControllerState::m_pitch))
+                ->Property("Position", BehaviorValueProperty(&FirstPersonControllerState::m_position));
+
+            bc->Class<FirstPersonControllerJumpPrediction>("FirstPersonControllerJumpPrediction")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "controller")
+                ->Attribute(AZ::Script::Attributes::Category, "First Person Controller")
+                ->Property("Valid", BehaviorValueProperty(&FirstPersonControllerJumpPrediction::m_valid))
+                ->Property("Apex Height", BehaviorValueProperty(&FirstPersonControllerJumpPrediction::m_apexHeight))
+                ->Property("Time To Apex", BehaviorValueProperty(&FirstPersonControllerJumpPrediction::m_timeToApex))
+                ->Property("Air Time", BehaviorValueProperty(&FirstPersonControllerJumpPrediction::m_airTime))
+                ->Property("Horizontal Reach", BehaviorValueProperty(&FirstPersonControllerJumpPrediction::m_horizontalReach));
+
+            bc->Class<FirstPersonControllerImpact>("FirstPersonControllerImpact")
+                ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
+                ->Attribute(AZ::Script::Attributes::Module, "controller")
+                ->Attribute(AZ::Script::Attributes::Category, "First Person Controller")
+                ->Property("EntityId", BehaviorValueProperty(&FirstPersonControllerImpact::m_entityId))
+                ->Property("Position", BehaviorValueProperty(&FirstPersonControllerImpact::m_position))
+                ->Property("Normal", BehaviorValueProperty(&FirstPersonControllerImpact::m_normal))
+                ->Property("Impact Velocity", BehaviorValueProperty(&FirstPersonControllerImpact::m_impactVelocity))
+                ->Property("MaterialId", BehaviorValueProperty(&FirstPersonControllerImpact::m_materialId))
+                ->Property("Air Time", BehaviorValueProperty(&FirstPersonControllerImpact::m_airTime));
+
             bc->EBus<FirstPersonControllerComponentRequestBus>("FirstPersonControllerComponentRequestBus")
                 ->Attribute(AZ::Script::Attributes::Scope, AZ::Script::Attributes::ScopeFlags::Common)
                 ->Attribute(AZ::Script::Attributes::Module, "controller")
@@ -385,6 +930,10 @@ namespace FirstPersonController
                 ->Event("Set Grounded For Tick", &FirstPersonControllerComponentRequests::SetGroundedForTick)
                 ->Event("Get Ground Scene Query Hits", &FirstPersonControllerComponentRequests::GetGroundSceneQueryHits)
                 ->Event("Get Ground Close Scene Query Hits", &FirstPersonControllerComponentRequests::GetGroundCloseSceneQueryHits)
+                ->Event("Get Ground Scene Query Hit Count", &FirstPersonControllerComponentRequests::GetGroundSceneQueryHitCount)
+                ->Event("Get Ground Scene Query Hit By Index", &FirstPersonControllerComponentRequests::GetGroundSceneQueryHitByIndex)
+                ->Event("Get Ground Close Scene Query Hit Count", &FirstPersonControllerComponentRequests::GetGroundCloseSceneQueryHitCount)
+                ->Event("Get Ground Close Scene Query Hit By Index", &FirstPersonControllerComponentRequests::GetGroundCloseSceneQueryHitByIndex)
                 ->Event("Get Ground Sum Normals Direction", &FirstPersonControllerComponentRequests::GetGroundSumNormalsDirection)
                 ->Event("Get Ground Close Sum Normals Direction", &FirstPersonControllerComponentRequests::GetGroundCloseSumNormalsDirection)
                 ->Event("Get Scene Query Hit Result Flags", &FirstPersonControllerComponentRequests::GetSceneQueryHitResultFlags)
@@ -434,6 +983,47 @@ namespace FirstPersonController
                 ->Event("Set Add Velocity For Physics Timestep Vs Tick", &FirstPersonControllerComponentRequests::SetAddVelocityForTimestepVsTick)
                 ->Event("Get Physics Timestep Scale Factor", &FirstPersonControllerComponentRequests::GetPhysicsTimestepScaleFactor)
                 ->Event("Set Physics Timestep Scale Factor", &FirstPersonControllerComponentRequests::SetPhysicsTimestepScaleFactor)
+                ->Event("Get Fixed Step In Tick Mode", &FirstPersonControllerComponentRequests::GetFixedStepTick)
+                ->Event("Set Fixed Step In Tick Mode", &FirstPersonControllerComponentRequests::SetFixedStepTick)
+                ->Event("Get Fixed Step Rate", &FirstPersonControllerComponentRequests::GetFixedStepRate)
+                ->Event("Set Fixed Step Rate", &FirstPersonControllerComponentRequests::SetFixedStepRate)
+                ->Event("Get Fixed Step Max Substeps", &FirstPersonControllerComponentRequests::GetFixedStepMaxSubsteps)
+                ->Event("Set Fixed Step Max Substeps", &FirstPersonControllerComponentRequests::SetFixedStepMaxSubsteps)
+                ->Event("Get Ground Queries Once Per Frame", &FirstPersonControllerComponentRequests::GetGroundQueriesOncePerFrame)
+                ->Event("Set Ground Queries Once Per Frame", &FirstPersonControllerComponentRequests::SetGroundQueriesOncePerFrame)
+                ->Event("Get Head Hit Query Once Per Frame", &FirstPersonControllerComponentRequests::GetHeadQueryOncePerFrame)
+                ->Event("Set Head Hit Query Once Per Frame", &FirstPersonControllerComponentRequests::SetHeadQueryOncePerFrame)
+                ->Event("Get Stand Query Once Per Frame", &FirstPersonControllerComponentRequests::GetStandQueryOncePerFrame)
+                ->Event("Set Stand Query Once Per Frame", &FirstPersonControllerComponentRequests::SetStandQueryOncePerFrame)
+                ->Event("Get Queue Setters From Other Threads", &FirstPersonControllerComponentRequests::GetQueueSetters)
+                ->Event("Set Queue Setters From Other Threads", &FirstPersonControllerComponentRequests::SetQueueSetters)
+                ->Event("Get Queue Input", &FirstPersonControllerComponentRequests::GetQueueInput)
+                ->Event("Set Queue Input", &FirstPersonControllerComponentRequests::SetQueueInput)
+                ->Event("Get Defer Notifications", &FirstPersonControllerComponentRequests::GetDeferNotifications)
+                ->Event("Set Defer Notifications", &FirstPersonControllerComponentRequests::SetDeferNotifications)
+                ->Event("Get Edge-Triggered Notifications", &FirstPersonControllerComponentRequests::GetNotificationsEdgeTriggered)
+                ->Event("Set Edge-Triggered Notifications", &FirstPersonControllerComponentRequests::SetNotificationsEdgeTriggered)
+                ->Event("Get Notification Min Interval", &FirstPersonControllerComponentRequests::GetNotificationMinInterval)
+                ->Event("Set Notification Min Interval", &FirstPersonControllerComponentRequests::SetNotificationMinInterval)
+                ->Event("Get Sleep When Idle", &FirstPersonControllerComponentRequests::GetSleepWhenIdle)
+                ->Event("Set Sleep When Idle", &FirstPersonControllerComponentRequests::SetSleepWhenIdle)
+                ->Event("Get Sleep Idle Delay", &FirstPersonControllerComponentRequests::GetSleepIdleDelay)
+                ->Event("Set Sleep Idle Delay", &FirstPersonControllerComponentRequests::SetSleepIdleDelay)
+                ->Event("Get Sleeping", &FirstPersonControllerComponentRequests::GetSleeping)
+                ->Event("Wake Up", &FirstPersonControllerComponentRequests::WakeUp)
+                ->Event("Get Update Tier", &FirstPersonControllerComponentRequests::GetUpdateTier)
+                ->Event("Set Update Tier", &FirstPersonControllerComponentRequests::SetUpdateTier)
+                ->Event("Get Crowd Separation", &FirstPersonControllerComponentRequests::GetCrowdSeparation)
+                ->Event("Set Crowd Separation", &FirstPersonControllerComponentRequests::SetCrowdSeparation)
+                ->Event("Get Separation Radius", &FirstPersonControllerComponentRequests::GetSeparationRadius)
+                ->Event("Set Separation Radius", &FirstPersonControllerComponentRequests::SetSeparationRadius)
+                ->Event("Get Separation Speed", &FirstPersonControllerComponentRequests::GetSeparationSpeed)
+                ->Event("Set Separation Speed", &FirstPersonControllerComponentRequests::SetSeparationSpeed)
+                ->Event("Get Separation Velocity XY", &FirstPersonControllerComponentRequests::GetSeparationVelocityXY)
+                ->Event("Reset Runtime State", &FirstPersonControllerComponentRequests::ResetRuntimeState)
+                ->Event("Teleport", &FirstPersonControllerComponentRequests::Teleport)
+                ->Event("Get Pooled", &FirstPersonControllerComponentRequests::GetPooled)
+                ->Event("Set Pooled", &FirstPersonControllerComponentRequests::SetPooled)
                 ->Event("Get Script Sets X&Y Target Velocity", &FirstPersonControllerComponentRequests::GetScriptSetsTargetVelocityXY)
                 ->Event("Set Script Sets X&Y Target Velocity", &FirstPersonControllerComponentRequests::SetScriptSetsTargetVelocityXY)
                 ->Event("Get X&Y Target Velocity", &FirstPersonControllerComponentRequests::GetTargetVelocityXY)
@@ -464,8 +1054,15 @@ namespace FirstPersonController
                 ->Event("Set Grounded Offset", &FirstPersonControllerComponentRequests::SetGroundedOffset)
                 ->Event("Get Ground Close Offset", &FirstPersonControllerComponentRequests::GetGroundCloseOffset)
                 ->Event("Set Ground Close Offset", &FirstPersonControllerComponentRequests::SetGroundCloseOffset)
+                ->Event("Get Ground Close Uses Time To Impact", &FirstPersonControllerComponentRequests::GetGroundCloseTimeToImpact)
+                ->Event("Set Ground Close Uses Time To Impact", &FirstPersonControllerComponentRequests::SetGroundCloseTimeToImpact)
+                ->Event("Get Ground Close Time To Impact", &FirstPersonControllerComponentRequests::GetGroundCloseTimeThreshold)
+                ->Event("Set Ground Close Time To Impact", &FirstPersonControllerComponentRequests::SetGroundCloseTimeThreshold)
+                ->Event("Get Time To Ground Impact", &FirstPersonControllerComponentRequests::GetTimeToGroundImpact)
                 ->Event("Get Jump Hold Distance", &FirstPersonControllerComponentRequests::GetJumpHoldDistance)
                 ->Event("Set Jump Hold Distance", &FirstPersonControllerComponentRequests::SetJumpHoldDistance)
+                ->Event("Get Exact Jump And Gravity Integration", &FirstPersonControllerComponentRequests::GetExactVelocityZ)
+                ->Event("Set Exact Jump And Gravity Integration", &FirstPersonControllerComponentRequests::SetExactVelocityZ)
                 ->Event("Get Jump Head Hit Sphere Cast Offset", &FirstPersonControllerComponentRequests::GetJumpHeadSphereCastOffset)
                 ->Event("Set Jump Head Hit Sphere Cast Offset", &FirstPersonControllerComponentRequests::SetJumpHeadSphereCastOffset)
                 ->Event("Get Head Hit Sets Apogee", &FirstPersonControllerComponentRequests::GetHeadHitSetsApogee)
@@ -477,6 +1074,8 @@ namespace FirstPersonController
                 ->Event("Get Head Hit Collision Group Name", &FirstPersonControllerComponentRequests::GetHeadCollisionGroupName)
                 ->Event("Set Head Hit Collision Group By Name", &FirstPersonControllerComponentRequests::SetHeadCollisionGroupByName)
                 ->Event("Get Head Hit EntityIds", &FirstPersonControllerComponentRequests::GetHeadHitEntityIds)
+                ->Event("Get Head Hit EntityId Count", &FirstPersonControllerComponentRequests::GetHeadHitEntityIdCount)
+                ->Event("Get Head Hit EntityId By Index", &FirstPersonControllerComponentRequests::GetHeadHitEntityIdByIndex)
                 ->Event("Get Stand Prevented", &FirstPersonControllerComponentRequests::GetStandPrevented)
                 ->Event("Set Stand Prevented", &FirstPersonControllerComponentRequests::SetStandPrevented)
                 ->Event("Get Stand Ignore Dynamic Rigid Bodies", &FirstPersonControllerComponentRequests::GetStandIgnoreDynamicRigidBodies)
@@ -484,6 +1083,8 @@ namespace FirstPersonController
                 ->Event("Get Stand Collision Group Name", &FirstPersonControllerComponentRequests::GetStandCollisionGroupName)
                 ->Event("Set Stand Collision Group By Name", &FirstPersonControllerComponentRequests::SetStandCollisionGroupByName)
                 ->Event("Get Stand Prevented EntityIds", &FirstPersonControllerComponentRequests::GetStandPreventedEntityIds)
+                ->Event("Get Stand Prevented EntityId Count", &FirstPersonControllerComponentRequests::GetStandPreventedEntityIdCount)
+                ->Event("Get Stand Prevented EntityId By Index", &FirstPersonControllerComponentRequests::GetStandPreventedEntityIdByIndex)
                 ->Event("Get Ground Sphere Casts' Radius Percentage Increase (%)", &FirstPersonControllerComponentRequests::GetGroundSphereCastsRadiusPercentageIncrease)
                 ->Event("Set Ground Sphere Casts' Radius Percentage Increase (%)", &FirstPersonControllerComponentRequests::SetGroundSphereCastsRadiusPercentageIncrease)
                 ->Event("Get Max Grounded Angle (Degrees)", &FirstPersonControllerComponentRequests::GetMaxGroundedAngleDegrees)
@@ -505,6 +1106,8 @@ namespace FirstPersonController
                 ->Event("Get Opposing Direction Deceleration Factor Applied", &FirstPersonControllerComponentRequests::GetOpposingDecelFactorApplied)
                 ->Event("Get Instant Velocity Rotation", &FirstPersonControllerComponentRequests::GetInstantVelocityRotation)
                 ->Event("Set Instant Velocity Rotation", &FirstPersonControllerComponentRequests::SetInstantVelocityRotation)
+                ->Event("Get Analytic Velocity Model", &FirstPersonControllerComponentRequests::GetAnalyticVelocityXY)
+                ->Event("Set Analytic Velocity Model", &FirstPersonControllerComponentRequests::SetAnalyticVelocityXY)
                 ->Event("Get Velocity X&Y Ignores Obstacles", &FirstPersonControllerComponentRequests::GetVelocityXYIgnoresObstacles)
                 ->Event("Set Velocity X&Y Ignores Obstacles", &FirstPersonControllerComponentRequests::SetVelocityXYIgnoresObstacles)
                 ->Event("Get Gravity Ignores Obstacles", &FirstPersonControllerComponentRequests::GetGravityIgnoresObstacles)
@@ -607,7 +1210,24 @@ namespace FirstPersonController
                 ->Event("Update Camera Pitch", &FirstPersonControllerComponentRequests::UpdateCameraPitch)
                 ->Event("Get Character Heading", &FirstPersonControllerComponentRequests::GetHeading)
                 ->Event("Set Character Heading For Tick", &FirstPersonControllerComponentRequests::SetHeadingForTick)
-                ->Event("Get Camera Pitch", &FirstPersonControllerComponentRequests::GetPitch);
+                ->Event("Get Camera Pitch", &FirstPersonControllerComponentRequests::GetPitch)
+                ->Event("Get State Snapshot", &FirstPersonControllerComponentRequests::GetStateSnapshot)
+                ->Event("Get Movement Profile Name", &FirstPersonControllerComponentRequests::GetMovementProfileName)
+                ->Event("Set Movement Profile Name", &FirstPersonControllerComponentRequests::SetMovementProfileName)
+                ->Event("Reapply Movement Profile", &FirstPersonControllerComponentRequests::ReapplyMovementProfile)
+                ->Event("Clear Movement Profile Overrides", &FirstPersonControllerComponentRequests::ClearMovementProfileOverrides)
+                ->Event("Predict Jump", &FirstPersonControllerComponentRequests::PredictJump)
+                ->Event("Test Jump Arc", &FirstPersonControllerComponentRequests::TestJumpArc)
+                ->Event("Add Property Threshold Watch", &FirstPersonControllerComponentRequests::AddPropertyThresholdWatch)
+                ->Event("Add Property Delta Watch", &FirstPersonControllerComponentRequests::AddPropertyDeltaWatch)
+                ->Event("Remove Property Watch", &FirstPersonControllerComponentRequests::RemovePropertyWatch)
+                ->Event("Clear Property Watches", &FirstPersonControllerComponentRequests::ClearPropertyWatches)
+                ->Event("Queue Move Command", &FirstPersonControllerComponentRequests::QueueMoveCommand)
+                ->Event("Queue Face Command", &FirstPersonControllerComponentRequests::QueueFaceCommand)
+                ->Event("Queue Jump Command", &FirstPersonControllerComponentRequests::QueueJumpCommand)
+                ->Event("Queue Crouch Command", &FirstPersonControllerComponentRequests::QueueCrouchCommand)
+                ->Event("Clear Movement Commands", &FirstPersonControllerComponentRequests::ClearMovementCommands)
+                ->Event("Get Movement Command Count", &FirstPersonControllerComponentRequests::GetMovementCommandCount);
 
             bc->Class<FirstPersonControllerComponent>()->RequestBus("FirstPersonControllerComponentRequestBus");
         }
@@ -646,9 +1266,8 @@ namespace FirstPersonController
         Physics::CollisionRequestBus::BroadcastResult(
             m_groundedCollisionGroup, &Physics::CollisionRequests::GetCollisionGroupById, m_groundedCollisionGroupId);
 
-        UpdateJumpMaxHoldTime();
-
-        AssignConnectInputEvents();
+        // Resolving the movement profile also updates the derived constants and connects the input events
+        ResolveMovementProfile();
 
         AZ::TickBus::Handler::BusConnect();
 
@@ -659,6 +1278,10 @@ namespace FirstPersonController
         AzFramework::InputChannelEventListener::SetFilter(filter);
 
         FirstPersonControllerComponentRequestBus::Handler::BusConnect(GetEntityId());
+
+        // Register with the system component so that C++ systems can obtain a direct handle to this controller
+        if(auto* firstPersonControllerInterface = FirstPersonControllerInterface::Get())
+            firstPersonControllerInterface->RegisterController(GetEntityId(), this, &m_publishedState);
     }
 
     void FirstPersonControllerComponent::OnCharacterActivated([[maybe_unused]] const AZ::EntityId& entityId)
@@ -674,18 +1297,13 @@ namespace FirstPersonController
         Physics::CharacterRequestBus::EventResult(m_maxGroundedAngleDegrees, GetEntityId(),
             &Physics::CharacterRequestBus::Events::GetSlopeLimitDegrees);
 
-        m_capsuleCurrentHeight = m_capsuleHeight;
-
-        if(m_crouchDistance > m_capsuleHeight - 2.f*m_capsuleRadius)
-            m_crouchDistance = m_capsuleHeight - 2.f*m_capsuleRadius;
+        m_hot.m_capsuleCurrentHeight = m_capsuleHeight;
 
         // Set the max grounded angle to be slightly greater than the PhysX Character Controller's
         // maximum slope angle value
         m_maxGroundedAngleDegrees += 0.01f;
 
-        // Set the sprint pause time based on whether the cooldown time or the max consecutive sprint time is longer
-        // This number can be altered using the RequestBus
-        m_sprintPauseTime = (m_sprintCooldownTime > m_sprintMaxTime) ? 0.f : 0.1f * m_sprintCooldownTime;
+        UpdateDerivedConstants();
 
         //AZ_Printf("", "m_capsuleHeight = %.10f", m_capsuleHeight);
         //AZ_Printf("", "m_capsuleRadius = %.10f", m_capsuleRadius);
@@ -694,6 +1312,9 @@ namespace FirstPersonController
 
     void FirstPersonControllerComponent::Deactivate()
     {
+        if(auto* firstPersonControllerInterface = FirstPersonControllerInterface::Get())
+            firstPersonControllerInterface->UnregisterController(GetEntityId());
+
         InputEventNotificationBus::MultiHandler::BusDisconnect();
         AZ::TickBus::Handler::BusDisconnect();
         InputChannelEventListener::Disconnect();
@@ -730,7 +1351,16 @@ namespace FirstPersonController
         // Disconnect prior to connecting since this may be a reassignment
         InputEventNotificationBus::MultiHandler::BusDisconnect();
 
-        if(m_controlMap.size() != (sizeof(m_inputNames) / sizeof(AZStd::string*)))
+        // Array of action names, read from the movement profile
+        const AZStd::string* inputNames[] = {
+            &m_movementProfile->m_forwardEventName, &m_movementProfile->m_backEventName,
+            &m_movementProfile->m_leftEventName, &m_movementProfile->m_rightEventName,
+            &m_movementProfile->m_yawEventName, &m_movementProfile->m_pitchEventName,
+            &m_movementProfile->m_sprintEventName, &m_movementProfile->m_crouchEventName,
+            &m_movementProfile->m_jumpEventName
+        };
+
+        if(m_controlMap.size() != AZ_ARRAY_SIZE(inputNames))
         {
             AZ_Error("First Person Controller Component", false, "Number of input IDs not equal to number of input names!");
         }
@@ -739,38 +1369,31 @@ namespace FirstPersonController
             for(auto& it_event: m_controlMap)
             {
                 *(it_event.first) = StartingPointInput::InputEventNotificationId(
-                    (m_inputNames[std::distance(m_controlMap.begin(), m_controlMap.find(it_event.first))])->c_str());
+                    (inputNames[std::distance(m_controlMap.begin(), m_controlMap.find(it_event.first))])->c_str());
                 InputEventNotificationBus::MultiHandler::BusConnect(*(it_event.first));
             }
         }
     }
 
+    namespace
+    {
+        AZ::u64 GetInputTimestamp()
+        {
+            return AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(AZStd::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+    } // namespace
+
     void FirstPersonControllerComponent::OnPressed(float value)
     {
         const InputEventNotificationId* inputId = InputEventNotificationBus::GetCurrentBusId();
         if(inputId == nullptr)
             return;
 
-        if(*inputId == m_sprintEventId)
-        {
-            if(m_grounded)
-            {
-                m_sprintValue = value;
-                m_sprintAccelValue = value * m_sprintAccelScale;
-            }
-            else
-                m_sprintValue = 0.f;
-        }
-
-        for(auto& it_event: m_controlMap)
-        {
-            if(*inputId == *(it_event.first) && !(*(it_event.first) == m_sprintEventId))
-            {
-                *(it_event.second) = value;
-                // print the local user ID and the action name CRC
-                //AZ_Printf("Pressed", it_event.first->ToString().c_str());
-            }
-        }
+        InputCommand command;
+        command.m_inputId = *inputId;
+        command.m_value = value;
+        command.m_type = InputCommandType::Pressed;
+        SubmitInputCommand(command);
     }
 
     void FirstPersonControllerComponent::OnReleased(float value)
@@ -779,15 +1402,11 @@ namespace FirstPersonController
         if(inputId == nullptr)
             return;
 
-        for(auto& it_event: m_controlMap)
-        {
-            if(*inputId == *(it_event.first))
-            {
-                *(it_event.second) = value;
-                // print the local user ID and the action name CRC
-                //AZ_Printf("Released", it_event.first->ToString().c_str());
-            }
-        }
+        InputCommand command;
+        command.m_inputId = *inputId;
+        command.m_value = value;
+        command.m_type = InputCommandType::Released;
+        SubmitInputCommand(command);
     }
 
     void FirstPersonControllerComponent::OnHeld(float value)
@@ -798,25 +1417,11 @@ namespace FirstPersonController
             return;
         }
 
-        if(*inputId == m_rotateYawEventId)
-        {
-            m_yawValue = value;
-        }
-        else if(*inputId == m_rotatePitchEventId)
-        {
-            m_pitchValue = value;
-        }
-        // Repeatedly update the sprint value since we are setting it to 1 under certain movement conditions
-        else if(*inputId == m_sprintEventId)
-        {
-            if(m_grounded || m_sprintPrevValue != 1.f)
-            {
-                m_sprintValue = value;
-                m_sprintAccelValue = value * m_sprintAccelScale;
-            }
-            else
-                m_sprintValue = 0.f;
-        }
+        InputCommand command;
+        command.m_inputId = *inputId;
+        command.m_value = value;
+        command.m_type = InputCommandType::Held;
+        SubmitInputCommand(command);
     }
 
     bool FirstPersonControllerComponent::OnInputChannelEventFiltered(const AzFramework::InputChannel& inputChannel)
@@ -833,47 +1438,160 @@ namespace FirstPersonController
 
     void FirstPersonControllerComponent::OnGamepadEvent(const AzFramework::InputChannel& inputChannel)
     {
-        // TODO: Implement gamepad support
-        const AzFramework::InputChannelId& channelId = inputChannel.GetInputChannelId();
+        InputCommand command;
+        command.m_gamepadChannel = inputChannel.GetInputChannelId().GetNameCrc32();
+        command.m_value = inputChannel.GetValue();
+        command.m_type = InputCommandType::Gamepad;
+        SubmitInputCommand(command);
+    }
+
+    void FirstPersonControllerComponent::SubmitInputCommand(const InputCommand& command)
+    {
+        WakeForRequest();
 
-        if(channelId == AzFramework::InputDeviceGamepad::ThumbStickDirection::LR)
+        if(!m_queueInput)
         {
-            m_rightValue = inputChannel.GetValue();
-            m_leftValue = 0.f;
+            ApplyInputCommand(command);
+            return;
         }
-        else if(channelId == AzFramework::InputDeviceGamepad::ThumbStickDirection::LL)
+
+        InputCommand timestampedCommand = command;
+        timestampedCommand.m_timestamp = GetInputTimestamp();
+        if(!m_inputCommands.Push(timestampedCommand))
+            AZ_Warning("First Person Controller Component", false, "The input command queue is full, the input event was dropped.");
+    }
+
+    // Applies every queued input command that was captured before the step started. Commands that arrive while the
+    // queue is being consumed are left for the next step so that each step works from a fixed set of inputs.
+    void FirstPersonControllerComponent::ConsumeInputCommands()
+    {
+        if(m_inputCommandsConsuming.exchange(true, AZStd::memory_order_acquire))
+            return;
+
+        const AZ::u64 stepTimestamp = GetInputTimestamp();
+        while(const InputCommand* command = m_inputCommands.Front())
         {
-            m_rightValue = 0.f;
-            m_leftValue = inputChannel.GetValue();
+            if(command->m_timestamp > stepTimestamp)
+                break;
+            ApplyInputCommand(*command);
+            m_inputCommands.PopFront();
         }
 
-        if(channelId == AzFramework::InputDeviceGamepad::ThumbStickDirection::LU)
+        m_inputCommandsConsuming.store(false, AZStd::memory_order_release);
+    }
+
+    void FirstPersonControllerComponent::ApplyInputCommand(const InputCommand& command)
+    {
+        if(command.m_type == InputCommandType::Pressed)
         {
-            m_forwardValue = inputChannel.GetValue();
-            m_backValue = 0.f;
+            if(command.m_inputId == m_sprintEventId)
+            {
+                if(m_hot.m_grounded)
+                {
+                    m_sprintValue = command.m_value;
+                    m_hot.m_sprintAccelValue = command.m_value * m_movementProfile->m_sprintAccelScale;
+                }
+                else
+                    m_sprintValue = 0.f;
+            }
+
+            for(auto& it_event: m_controlMap)
+            {
+                if(command.m_inputId == *(it_event.first) && !(*(it_event.first) == m_sprintEventId))
+                {
+                    *(it_event.second) = command.m_value;
+                    // print the local user ID and the action name CRC
+                    //AZ_Printf("Pressed", it_event.first->ToString().c_str());
+                }
+            }
         }
-        else if(channelId == AzFramework::InputDeviceGamepad::ThumbStickDirection::LD)
+        else if(command.m_type == InputCommandType::Released)
         {
-            m_forwardValue = 0.f;
-            m_backValue = inputChannel.GetValue();
+            for(auto& it_event: m_controlMap)
+            {
+                if(command.m_inputId == *(it_event.first))
+                {
+                    *(it_event.second) = command.m_value;
+                    // print the local user ID and the action name CRC
+                    //AZ_Printf("Released", it_event.first->ToString().c_str());
+                }
+            }
         }
-
-        if(channelId == AzFramework::InputDeviceGamepad::ThumbStickAxis1D::RX)
+        else if(command.m_type == InputCommandType::Held)
         {
-            m_cameraRotationAngles[2] = -1.f*inputChannel.GetValue() * m_yawSensitivity;
-            m_rotatingYawViaScriptGamepad = true;
+            if(command.m_inputId == m_rotateYawEventId)
+            {
+                m_yawValue = command.m_value;
+            }
+            else if(command.m_inputId == m_rotatePitchEventId)
+            {
+                m_pitchValue = command.m_value;
+            }
+            // Repeatedly update the sprint value since we are setting it to 1 under certain movement conditions
+            else if(command.m_inputId == m_sprintEventId)
+            {
+                if(m_hot.m_grounded || m_hot.m_sprintPrevValue != 1.f)
+                {
+                    m_sprintValue = command.m_value;
+                    m_hot.m_sprintAccelValue = command.m_value * m_movementProfile->m_sprintAccelScale;
+                }
+                else
+                    m_sprintValue = 0.f;
+            }
         }
-
-        if(channelId == AzFramework::InputDeviceGamepad::ThumbStickAxis1D::RY)
+        else
         {
-            m_cameraRotationAngles[0] = inputChannel.GetValue() * m_pitchSensitivity;
-            m_rotatingPitchViaScriptGamepad = true;
+            // TODO: Implement gamepad support
+            const AZ::Crc32& channel = command.m_gamepadChannel;
+
+            if(channel == AzFramework::InputDeviceGamepad::ThumbStickDirection::LR.GetNameCrc32())
+            {
+                m_rightValue = command.m_value;
+                m_leftValue = 0.f;
+            }
+            else if(channel == AzFramework::InputDeviceGamepad::ThumbStickDirection::LL.GetNameCrc32())
+            {
+                m_rightValue = 0.f;
+                m_leftValue = command.m_value;
+            }
+
+            if(channel == AzFramework::InputDeviceGamepad::ThumbStickDirection::LU.GetNameCrc32())
+            {
+                m_forwardValue = command.m_value;
+                m_backValue = 0.f;
+            }
+            else if(channel == AzFramework::InputDeviceGamepad::ThumbStickDirection::LD.GetNameCrc32())
+            {
+                m_forwardValue = 0.f;
+                m_backValue = command.m_value;
+            }
+
+            if(channel == AzFramework::InputDeviceGamepad::ThumbStickAxis1D::RX.GetNameCrc32())
+            {
+                m_hot.m_cameraRotationAngles[2] = -1.f*command.m_value * m_yawSensitivity;
+                m_hot.m_rotatingYawViaScriptGamepad = true;
+            }
+
+            if(channel == AzFramework::InputDeviceGamepad::ThumbStickAxis1D::RY.GetNameCrc32())
+            {
+                m_hot.m_cameraRotationAngles[0] = command.m_value * m_pitchSensitivity;
+                m_hot.m_rotatingPitchViaScriptGamepad = true;
+            }
         }
     }
 
     void FirstPersonControllerComponent::OnTick(float deltaTime, AZ::ScriptTimePoint)
     {
+        // Advance the frame counter that the once per frame scene query policies compare against
+        ++m_frameCounter;
+
         ProcessInput(deltaTime, false);
+
+        if(!m_propertyWatches.empty())
+            EvaluatePropertyWatches();
+
+        if(m_deferNotifications)
+            FlushNotifications(deltaTime);
     }
 
     void FirstPersonControllerComponent::OnSceneSimulationStart(float physicsTimestep)
@@ -895,19 +1613,19 @@ namespace FirstPersonController
     {
         // Multiply by -1 since moving the mouse to the right produces a positive value
         // but a positive rotation about Z is counterclockwise
-        if(!m_rotatingYawViaScriptGamepad)
-            m_cameraRotationAngles[2] = -1.f * m_yawValue * m_yawSensitivity;
+        if(!m_hot.m_rotatingYawViaScriptGamepad)
+            m_hot.m_cameraRotationAngles[2] = -1.f * m_yawValue * m_yawSensitivity;
         else
-            m_rotatingYawViaScriptGamepad = false;
+            m_hot.m_rotatingYawViaScriptGamepad = false;
 
         // Multiply by -1 since moving the mouse up produces a negative value from the input bus
-        if(!m_rotatingPitchViaScriptGamepad)
-            m_cameraRotationAngles[0] = -1.f * m_pitchValue * m_pitchSensitivity;
+        if(!m_hot.m_rotatingPitchViaScriptGamepad)
+            m_hot.m_cameraRotationAngles[0] = -1.f * m_pitchValue * m_pitchSensitivity;
         else
-            m_rotatingPitchViaScriptGamepad = false;
+            m_hot.m_rotatingPitchViaScriptGamepad = false;
 
         const AZ::Quaternion targetLookRotationDelta = AZ::Quaternion::CreateFromEulerAnglesRadians(
-            AZ::Vector3::CreateFromFloat3(m_cameraRotationAngles));
+            AZ::Vector3::CreateFromFloat3(m_hot.m_cameraRotationAngles));
 
         if(m_rotationDamp*deltaTime <= 1.f)
         {
@@ -937,13 +1655,13 @@ namespace FirstPersonController
                                         t->GetLocalRotation().GetY(),
                                         t->GetLocalRotation().GetZ()));
 
-        if(!m_scriptSetcurrentHeadingTick)
-            m_currentHeading = GetEntity()->GetTransform()->
+        if(!m_hot.m_scriptSetcurrentHeadingTick)
+            m_hot.m_currentHeading = GetEntity()->GetTransform()->
                 GetWorldRotationQuaternion().GetEulerRadians().GetZ();
         else
-            m_scriptSetcurrentHeadingTick = false;
+            m_hot.m_scriptSetcurrentHeadingTick = false;
 
-        m_currentPitch = GetActiveCameraEntityPtr()->GetTransform()->
+        m_hot.m_currentPitch = GetActiveCameraEntityPtr()->GetTransform()->
             GetWorldRotationQuaternion().GetEulerRadians().GetX();
     }
 
@@ -951,188 +1669,214 @@ namespace FirstPersonController
     // and it's with respect to the world when m_instantVelocityRotation == false
     AZ::Vector2 FirstPersonControllerComponent::LerpVelocityXY(const AZ::Vector2& targetVelocityXY, const float& deltaTime)
     {
-        m_totalLerpTime = m_prevApplyVelocityXY.GetDistance(targetVelocityXY)/m_accel;
+        m_hot.m_totalLerpTime = m_hot.m_prevApplyVelocityXY.GetDistance(targetVelocityXY)/m_movementProfile->m_walkAcceleration;
 
-        if(m_totalLerpTime == 0.f)
+        if(m_hot.m_totalLerpTime == 0.f)
         {
-            m_accelerating = false;
-            m_decelerationFactorApplied = false;
-            m_opposingDecelFactorApplied = false;
-            return m_prevApplyVelocityXY;
+            m_hot.m_accelerating = false;
+            m_hot.m_decelerationFactorApplied = false;
+            m_hot.m_opposingDecelFactorApplied = false;
+            return m_hot.m_prevApplyVelocityXY;
         }
 
-        // Apply the sprint factor to the acceleration (dt) based on the sprint having been (recently) pressed
-        const float lastLerpTime = m_lerpTime;
-
-        float lerpDeltaTime = (m_sprintAccumulatedAccel > 0.f || m_sprintVelocityAdjust != 1.f) ? deltaTime * m_sprintAccelAdjust : deltaTime;
-        if(m_sprintAccelValue < 1.f && m_sprintAccumulatedAccel > 0.f)
-            lerpDeltaTime = deltaTime *  m_sprintAccelAdjust;
-
-        lerpDeltaTime *= m_grounded ? 1.f : m_jumpAccelFactor;
-
-        m_lerpTime += lerpDeltaTime * 0.5f;
+        const float lastLerpTime = m_hot.m_lerpTime;
 
-        if(m_lerpTime >= m_totalLerpTime)
-            m_lerpTime = m_totalLerpTime;
+        const float lerpDeltaTime = ComputeLerpDeltaTime(deltaTime);
 
         // Lerp the velocity from the last applied velocity to the target velocity
-        AZ::Vector2 newVelocityXY = m_prevApplyVelocityXY.Lerp(targetVelocityXY, m_lerpTime / m_totalLerpTime);
-
-        if(m_lerpTime != m_totalLerpTime)
-            m_lerpTime += lerpDeltaTime * 0.5f;
+        AZ::Vector2 newVelocityXY = LerpVelocityXYStep(m_hot.m_prevApplyVelocityXY, targetVelocityXY, m_hot.m_totalLerpTime, lerpDeltaTime, m_hot.m_lerpTime);
 
         // Decelerate at a different rate than the acceleration
-        if(newVelocityXY.GetLength() < m_applyVelocityXY.GetLength())
+        if(newVelocityXY.GetLength() < m_hot.m_applyVelocityXY.GetLength())
         {
-            m_accelerating = false;
-            m_decelerationFactorApplied = true;
+            m_hot.m_accelerating = false;
+            m_hot.m_decelerationFactorApplied = true;
             // Get the current velocity vector with respect to the character's local coordinate system
-            const AZ::Vector2 applyVelocityHeading = AZ::Vector2(AZ::Quaternion::CreateRotationZ(-m_currentHeading).TransformVector(AZ::Vector3(m_applyVelocityXY)));
+            const AZ::Vector2 applyVelocityHeading = AZ::Vector2(AZ::Quaternion::CreateRotationZ(-m_hot.m_currentHeading).TransformVector(AZ::Vector3(m_hot.m_applyVelocityXY)));
 
             // Compare the direction of the current velocity vector against the desired direction
             // and if it's greater than 90 degrees then decelerate even more
             if(targetVelocityXY.GetLength() != 0.f
                 && m_instantVelocityRotation ?
                     (abs(applyVelocityHeading.AngleSafe(targetVelocityXY)) > AZ::Constants::HalfPi)
-                    : (abs(m_applyVelocityXY.AngleSafe(targetVelocityXY)) > AZ::Constants::HalfPi))
-            {
-                m_opposingDecelFactorApplied = true;
-                m_decelerationFactorApplied = false;
-                // Compute the deceleration factor based on the magnitude of the target velocity
-                float greatestScale = m_forwardScale;
-                for(float scale: {m_forwardScale, m_backScale, m_leftScale, m_rightScale})
-                    if(greatestScale < abs(scale))
-                        greatestScale = abs(scale);
-
-                AZ::Vector2 targetVelocityXYLocal = targetVelocityXY;
-                if(!m_instantVelocityRotation)
-                    targetVelocityXYLocal = AZ::Vector2(AZ::Quaternion::CreateRotationZ(-m_currentHeading).TransformVector(AZ::Vector3(targetVelocityXY)));
-
-                if(m_standing || m_sprintWhileCrouched)
-                    m_decelerationFactor = (m_decel + (m_opposingDecel - m_decel) * targetVelocityXYLocal.GetLength() / (m_speed * (1.f + (m_sprintVelocityAdjust-1.f)) * greatestScale));
-                else
-                    m_decelerationFactor = (m_decel + (m_opposingDecel - m_decel) * targetVelocityXYLocal.GetLength() / (m_speed * m_crouchScale * greatestScale));
+                    : (abs(m_hot.m_applyVelocityXY.AngleSafe(targetVelocityXY)) > AZ::Constants::HalfPi))
+            {
+                m_hot.m_opposingDecelFactorApplied = true;
+                m_hot.m_decelerationFactorApplied = false;
+                m_hot.m_decelerationFactor = ComputeOpposingDecelerationFactor(targetVelocityXY);
             }
             else
             {
-                m_decelerationFactor = m_decel;
-                m_opposingDecelFactorApplied = false;
+                m_hot.m_decelerationFactor = m_movementProfile->m_deceleration;
+                m_hot.m_opposingDecelFactorApplied = false;
             }
 
             // Use the deceleration factor to get the lerp time closer to the total lerp time at a faster rate
-            m_lerpTime = lastLerpTime + lerpDeltaTime * m_decelerationFactor * 0.5f;
-
-            if(m_lerpTime >= m_totalLerpTime)
-                m_lerpTime = m_totalLerpTime;
-
-            AZ::Vector2 newVelocityXYDecel =  m_prevApplyVelocityXY.Lerp(targetVelocityXY, m_lerpTime / m_totalLerpTime);
-            if(newVelocityXYDecel.GetLength() < m_applyVelocityXY.GetLength())
+            m_hot.m_lerpTime = lastLerpTime;
+            const AZ::Vector2 newVelocityXYDecel = LerpVelocityXYStep(m_hot.m_prevApplyVelocityXY, targetVelocityXY,
+                m_hot.m_totalLerpTime, lerpDeltaTime * m_hot.m_decelerationFactor, m_hot.m_lerpTime);
+            if(newVelocityXYDecel.GetLength() < m_hot.m_applyVelocityXY.GetLength())
                 newVelocityXY = newVelocityXYDecel;
-
-            if(m_lerpTime != m_totalLerpTime)
-                m_lerpTime += lerpDeltaTime * m_decelerationFactor * 0.5f;
         }
         else
         {
-            m_accelerating = true;
-            m_decelerationFactorApplied = false;
-            m_opposingDecelFactorApplied = false;
-        }
-
-        if(!AZ::IsClose(m_sprintAccelAdjust, 1.f))
-        {
-            if(!AZ::IsClose(m_sprintVelocityAdjust, 1.f) || (newVelocityXY.GetLength() < m_applyVelocityXY.GetLength()))
-                m_sprintAccumulatedAccel += (newVelocityXY.GetLength() - m_applyVelocityXY.GetLength());
-            else
-                m_sprintAccumulatedAccel = 0.f;
-
-            if(m_sprintAccumulatedAccel < 0.f)
-                m_sprintAccumulatedAccel = 0.f;
+            m_hot.m_accelerating = true;
+            m_hot.m_decelerationFactorApplied = false;
+            m_hot.m_opposingDecelFactorApplied = false;
         }
-        else
-            m_sprintAccumulatedAccel = 0.f;
 
-        if(m_applyVelocityXY == AZ::Vector2::CreateZero())
-            FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStartedMoving);
-
-        if(newVelocityXY == targetVelocityXY)
-        {
-            FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnTargetVelocityReached);
-
-            const bool vXCrossYPos = (m_velocityXCrossYDirection.GetZ() >= 0.f);
-            if(newVelocityXY.GetLength() == 0.f)
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStopped);
-            else if(vXCrossYPos && (newVelocityXY.GetLength() == m_speed * CreateEllipseScaledVector(newVelocityXY.GetNormalized(), m_forwardScale, m_backScale, m_leftScale, m_rightScale).GetLength()))
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnTopWalkSpeedReached);
-            else if(!vXCrossYPos && (newVelocityXY.GetLength() == m_speed * CreateEllipseScaledVector((-newVelocityXY).GetNormalized(), m_forwardScale, m_backScale, m_leftScale, m_rightScale).GetLength()))
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnTopWalkSpeedReached);
-            else if(vXCrossYPos && newVelocityXY.GetLength() == m_speed * CreateEllipseScaledVector(newVelocityXY.GetNormalized(), m_sprintScaleForward*m_forwardScale, m_sprintScaleBack*m_backScale, m_sprintScaleLeft*m_leftScale, m_sprintScaleRight*m_rightScale).GetLength())
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnTopSprintSpeedReached);
-            else if(!vXCrossYPos && newVelocityXY.GetLength() == m_speed * CreateEllipseScaledVector((-newVelocityXY).GetNormalized(), m_sprintScaleForward*m_forwardScale, m_sprintScaleBack*m_backScale, m_sprintScaleLeft*m_leftScale, m_sprintScaleRight*m_rightScale).GetLength())
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnTopSprintSpeedReached);
-        }
+        FinishVelocityXYStep(newVelocityXY, targetVelocityXY);
 
         return newVelocityXY;
     }
 
-    AZ::Vector2 FirstPersonControllerComponent::CreateEllipseScaledVector(const AZ::Vector2& unscaledVector, float forwardScale, float backScale, float leftScale, float rightScale)
+    // Alternative to LerpVelocityXY() which moves the velocity toward the target velocity at a bounded rate in a single pass.
+    // The rate is the walking acceleration scaled by the same sprint, jumping, and deceleration factors that LerpVelocityXY()
+    // applies to its lerp time, so top speeds and the times taken to reach them match. The velocity returned is the average
+    // over the step, which keeps the distance travelled independent of the step rate.
+    AZ::Vector2 FirstPersonControllerComponent::AnalyticVelocityXY(const AZ::Vector2& targetVelocityXY, const float& deltaTime)
     {
-        AZ::Vector2 scaledVector = AZ::Vector2::CreateZero();
+        // Continue from the velocity at the end of the last step. The last applied velocity is the average over that
+        // step, so it's only used as the starting point after it was replaced, such as by a correction from hitting something.
+        const AZ::Vector2 startVelocityXY = m_hot.m_analyticVelocityRestart ? m_hot.m_prevApplyVelocityXY : m_hot.m_analyticVelocityXY;
+        m_hot.m_analyticVelocityRestart = false;
 
-        if(unscaledVector.IsZero())
-            return AZ::Vector2::CreateZero();
+        const AZ::Vector2 deltaVelocityXY = targetVelocityXY - startVelocityXY;
+        const float deltaVelocityLength = deltaVelocityXY.GetLength();
 
-        // If the input vector isn't normalized then scale the scale factors accordingly
-        if(!unscaledVector.IsNormalized())
+        if(deltaVelocityLength == 0.f || deltaTime <= 0.f)
         {
-            forwardScale *= unscaledVector.GetLength();
-            backScale *= unscaledVector.GetLength();
-            leftScale *= unscaledVector.GetLength();
-            rightScale *= unscaledVector.GetLength();
+            m_hot.m_accelerating = false;
+            m_hot.m_decelerationFactorApplied = false;
+            m_hot.m_opposingDecelFactorApplied = false;
+            m_hot.m_analyticVelocityXY = startVelocityXY;
+            m_hot.m_totalLerpTime = m_hot.m_lerpTime;
+            return startVelocityXY;
         }
 
-        // Quadrant I
-        if(unscaledVector.GetY() >= 0.f && unscaledVector.GetX() >= 0.f)
-        {
-            scaledVector.SetX((forwardScale * rightScale) /
-                sqrt(forwardScale*forwardScale + rightScale*rightScale * pow(tan(unscaledVector.AngleSafe(AZ::Vector2::CreateAxisX())), 2.f)));
-            scaledVector.SetY(scaledVector.GetX()*tan(unscaledVector.AngleSafe(AZ::Vector2::CreateAxisX())));
-        }
-        // Quadrant II
-        else if(unscaledVector.GetY() >= 0.f && unscaledVector.GetX() < 0.f)
-        {
-            scaledVector.SetX(-1.f*(forwardScale * leftScale) /
-                sqrt(forwardScale*forwardScale + leftScale*leftScale * pow(tan(unscaledVector.AngleSafe(AZ::Vector2::CreateAxisX(-1.f))), 2.f)));
-            scaledVector.SetY(-1.f*scaledVector.GetX()*tan(unscaledVector.AngleSafe(AZ::Vector2::CreateAxisX(-1.f))));
-        }
-        // Quadrant III
-        else if(unscaledVector.GetY() < 0.f && unscaledVector.GetX() < 0.f)
+        float rate = m_movementProfile->m_walkAcceleration;
+
+        // The speed decreases when the change in velocity points against the current velocity
+        if(deltaVelocityXY.Dot(startVelocityXY) < 0.f)
         {
-            scaledVector.SetX(-1.f*(backScale * leftScale) /
-                sqrt(backScale*backScale + leftScale*leftScale * pow(tan(unscaledVector.AngleSafe(AZ::Vector2::CreateAxisX(-1.f))), 2.f)));
-            scaledVector.SetY(scaledVector.GetX()*tan(unscaledVector.AngleSafe(AZ::Vector2::CreateAxisX(-1.f))));
+            m_hot.m_accelerating = false;
+            if(!targetVelocityXY.IsZero() && startVelocityXY.Dot(targetVelocityXY) < 0.f)
+            {
+                m_hot.m_opposingDecelFactorApplied = true;
+                m_hot.m_decelerationFactorApplied = false;
+                m_hot.m_decelerationFactor = ComputeOpposingDecelerationFactor(targetVelocityXY);
+            }
+            else
+            {
+                m_hot.m_decelerationFactorApplied = true;
+                m_hot.m_opposingDecelFactorApplied = false;
+                m_hot.m_decelerationFactor = m_movementProfile->m_deceleration;
+            }
+            rate *= m_hot.m_decelerationFactor;
         }
-        // Quadrant IV
         else
         {
-            scaledVector.SetX((backScale * rightScale) /
-                sqrt(backScale*backScale + rightScale*rightScale * pow(tan(unscaledVector.AngleSafe(AZ::Vector2::CreateAxisX())), 2.f)));
-            scaledVector.SetY(-1.f*scaledVector.GetX()*tan(unscaledVector.AngleSafe(AZ::Vector2::CreateAxisX())));
+            m_hot.m_accelerating = true;
+            m_hot.m_decelerationFactorApplied = false;
+            m_hot.m_opposingDecelFactorApplied = false;
         }
 
-        return scaledVector;
+        rate *= ComputeLerpDeltaTime(deltaTime) / deltaTime;
+
+        // The lerp time is reset whenever the target velocity changes. The total is the time at which the target velocity
+        // is reached at the current rate, so that both read the same way as with LerpVelocityXY().
+        if(rate > 0.f)
+            m_hot.m_totalLerpTime = m_hot.m_lerpTime + deltaVelocityLength / rate;
+        m_hot.m_lerpTime = AZ::GetMin(m_hot.m_lerpTime + deltaTime, m_hot.m_totalLerpTime);
+
+        const AZ::Vector2 newVelocityXY = RampVelocityXY(startVelocityXY, targetVelocityXY, rate, deltaTime, m_hot.m_analyticVelocityXY);
+
+        FinishVelocityXYStep(newVelocityXY, targetVelocityXY);
+
+        return newVelocityXY;
     }
 
-    // Here target velocity is with respect to the character's frame of reference
-    void FirstPersonControllerComponent::SprintManager(const AZ::Vector2& targetVelocityXY, const float& deltaTime)
+    // Apply the sprint factor to the acceleration (dt) based on the sprint having been (recently) pressed,
+    // and the jump acceleration factor when in the air
+    float FirstPersonControllerComponent::ComputeLerpDeltaTime(const float& deltaTime) const
     {
-        // The sprint value should never be 0, it shouldn't be applied if you're trying to moving backwards,
-        // and it shouldn't be applied if you're crouching (depending on various settings)
-        if(m_sprintValue == 0.f
-           || (!m_sprintWhileCrouched && !m_crouchSprintCausesStanding && !m_standing)
-           || (!m_applyVelocityXY.GetY() && !m_applyVelocityXY.GetX())
-           || (m_forwardValue == -m_backValue && -m_leftValue == m_rightValue)
-           || (targetVelocityXY.IsZero())
+        float lerpDeltaTime = (m_hot.m_sprintAccumulatedAccel > 0.f || m_hot.m_sprintVelocityAdjust != 1.f) ? deltaTime * m_hot.m_sprintAccelAdjust : deltaTime;
+        if(m_hot.m_sprintAccelValue < 1.f && m_hot.m_sprintAccumulatedAccel > 0.f)
+            lerpDeltaTime = deltaTime *  m_hot.m_sprintAccelAdjust;
+
+        lerpDeltaTime *= m_hot.m_grounded ? 1.f : m_movementProfile->m_jumpAccelFactor;
+
+        return lerpDeltaTime;
+    }
+
+    // Compute the deceleration factor based on the magnitude of the target velocity
+    float FirstPersonControllerComponent::ComputeOpposingDecelerationFactor(const AZ::Vector2& targetVelocityXY) const
+    {
+        AZ::Vector2 targetVelocityXYLocal = targetVelocityXY;
+        if(!m_instantVelocityRotation)
+            targetVelocityXYLocal = AZ::Vector2(AZ::Quaternion::CreateRotationZ(-m_hot.m_currentHeading).TransformVector(AZ::Vector3(targetVelocityXY)));
+
+        if(m_hot.m_standing || m_sprintWhileCrouched)
+            return (m_movementProfile->m_deceleration + (m_movementProfile->m_opposingDeceleration - m_movementProfile->m_deceleration) * targetVelocityXYLocal.GetLength() / (m_derived.m_greatestWalkSpeed * m_hot.m_sprintVelocityAdjust));
+        else
+            return (m_movementProfile->m_deceleration + (m_movementProfile->m_opposingDeceleration - m_movementProfile->m_deceleration) * targetVelocityXYLocal.GetLength() / m_derived.m_greatestCrouchSpeed);
+    }
+
+    // Sprint acceleration accumulation and the X&Y movement notifications shared by both velocity models
+    void FirstPersonControllerComponent::FinishVelocityXYStep(const AZ::Vector2& newVelocity, const AZ::Vector2& targetVelocity)
+    {
+        if(!AZ::IsClose(m_hot.m_sprintAccelAdjust, 1.f))
+        {
+            if(!AZ::IsClose(m_hot.m_sprintVelocityAdjust, 1.f) || (newVelocity.GetLength() < m_hot.m_applyVelocityXY.GetLength()))
+                m_hot.m_sprintAccumulatedAccel += (newVelocity.GetLength() - m_hot.m_applyVelocityXY.GetLength());
+            else
+                m_hot.m_sprintAccumulatedAccel = 0.f;
+
+            if(m_hot.m_sprintAccumulatedAccel < 0.f)
+                m_hot.m_sprintAccumulatedAccel = 0.f;
+        }
+        else
+            m_hot.m_sprintAccumulatedAccel = 0.f;
+
+        if(m_hot.m_applyVelocityXY == AZ::Vector2::CreateZero())
+            Notify(NotificationEvent::StartedMoving);
+
+        if(newVelocity == targetVelocity)
+        {
+            Notify(NotificationEvent::TargetVelocityReached);
+
+            const bool vXCrossYPos = (m_velocityXCrossYDirection.GetZ() >= 0.f);
+            if(newVelocity.GetLength() == 0.f)
+                Notify(NotificationEvent::Stopped);
+            else if(vXCrossYPos && (newVelocity.GetLength() == m_movementProfile->m_topWalkSpeed * CreateEllipseScaledVector(newVelocity.GetNormalized(), m_movementProfile->m_forwardScale, m_movementProfile->m_backScale, m_movementProfile->m_leftScale, m_movementProfile->m_rightScale).GetLength()))
+                Notify(NotificationEvent::TopWalkSpeedReached);
+            else if(!vXCrossYPos && (newVelocity.GetLength() == m_movementProfile->m_topWalkSpeed * CreateEllipseScaledVector((-newVelocity).GetNormalized(), m_movementProfile->m_forwardScale, m_movementProfile->m_backScale, m_movementProfile->m_leftScale, m_movementProfile->m_rightScale).GetLength()))
+                Notify(NotificationEvent::TopWalkSpeedReached);
+            else if(vXCrossYPos && newVelocity.GetLength() == m_movementProfile->m_topWalkSpeed * CreateEllipseScaledVector(newVelocity.GetNormalized(), m_derived.m_sprintDirectionScales[0], m_derived.m_sprintDirectionScales[1], m_derived.m_sprintDirectionScales[2], m_derived.m_sprintDirectionScales[3]).GetLength())
+                Notify(NotificationEvent::TopSprintSpeedReached);
+            else if(!vXCrossYPos && newVelocity.GetLength() == m_movementProfile->m_topWalkSpeed * CreateEllipseScaledVector((-newVelocity).GetNormalized(), m_derived.m_sprintDirectionScales[0], m_derived.m_sprintDirectionScales[1], m_derived.m_sprintDirectionScales[2], m_derived.m_sprintDirectionScales[3]).GetLength())
+                Notify(NotificationEvent::TopSprintSpeedReached);
+        }
+    }
+
+    AZ::Vector2 FirstPersonControllerComponent::CreateEllipseScaledVector(const AZ::Vector2& unscaledVector, float forwardScale, float backScale, float leftScale, float rightScale)
+    {
+        // The closed form is shared with the batch kernel, if the input vector isn't normalized then its length scales the result
+        float scaledX, scaledY;
+        EllipseScaleXY(unscaledVector.GetX(), unscaledVector.GetY(), forwardScale, backScale, leftScale, rightScale, scaledX, scaledY);
+        return AZ::Vector2(scaledX, scaledY);
+    }
+
+    // Here target velocity is with respect to the character's frame of reference
+    void FirstPersonControllerComponent::SprintManager(const AZ::Vector2& targetVelocityXY, const float& deltaTime)
+    {
+        // The sprint value should never be 0, it shouldn't be applied if you're trying to moving backwards,
+        // and it shouldn't be applied if you're crouching (depending on various settings)
+        if(m_sprintValue == 0.f
+           || (!m_sprintWhileCrouched && !m_crouchSprintCausesStanding && !m_hot.m_standing)
+           || (!m_hot.m_applyVelocityXY.GetY() && !m_hot.m_applyVelocityXY.GetX())
+           || (m_forwardValue == -m_backValue && -m_leftValue == m_rightValue)
+           || (targetVelocityXY.IsZero())
            || (m_sprintValue != 0.f
                && !m_sprintBackwards
                && ((!m_forwardValue && !m_leftValue && !m_rightValue) ||
@@ -1143,189 +1887,183 @@ namespace FirstPersonController
         if((m_sprintViaScript && m_sprintEnableDisableScript) && (targetVelocityXY.GetY() > 0.f || m_sprintBackwards))
         {
             m_sprintValue = 1.f;
-            m_sprintAccelValue = m_sprintAccelScale;
+            m_hot.m_sprintAccelValue = m_movementProfile->m_sprintAccelScale;
         }
         else if(m_sprintViaScript && !m_sprintEnableDisableScript)
             m_sprintValue = 0.f;
 
         // Reset the counter if there is no movement
-        if(m_applyVelocityXY.IsZero())
-            m_sprintAccumulatedAccel = 0.f;
+        if(m_hot.m_applyVelocityXY.IsZero())
+            m_hot.m_sprintAccumulatedAccel = 0.f;
+
+        const double now = m_hot.m_timerClock;
+        const float sprintHeldDuration = GetSprintHeldDurationAt(now);
 
-        if(m_sprintValue == 0.f || m_sprintCooldown != 0.f)
-            m_sprintVelocityAdjust = 1.f;
+        if(m_sprintValue == 0.f || m_hot.m_sprintCoolingDown)
+            m_hot.m_sprintVelocityAdjust = 1.f;
         else
         {
             if(m_velocityXCrossYDirection.GetZ() >= 0.f)
-                m_sprintVelocityAdjust = CreateEllipseScaledVector(targetVelocityXY.GetNormalized(), m_sprintScaleForward, m_sprintScaleBack, m_sprintScaleLeft, m_sprintScaleRight).GetLength();
+                m_hot.m_sprintVelocityAdjust = CreateEllipseScaledVector(targetVelocityXY.GetNormalized(), m_movementProfile->m_sprintScaleForward, m_movementProfile->m_sprintScaleBack, m_movementProfile->m_sprintScaleLeft, m_movementProfile->m_sprintScaleRight).GetLength();
             else
-                m_sprintVelocityAdjust = CreateEllipseScaledVector((-targetVelocityXY).GetNormalized(), m_sprintScaleForward, m_sprintScaleBack, m_sprintScaleLeft, m_sprintScaleRight).GetLength();
+                m_hot.m_sprintVelocityAdjust = CreateEllipseScaledVector((-targetVelocityXY).GetNormalized(), m_movementProfile->m_sprintScaleForward, m_movementProfile->m_sprintScaleBack, m_movementProfile->m_sprintScaleLeft, m_movementProfile->m_sprintScaleRight).GetLength();
         }
 
-        if(m_sprintPrevValue == 0.f && !AZ::IsClose(m_sprintVelocityAdjust, 1.f) && m_sprintHeldDuration < m_sprintMaxTime && m_sprintCooldown == 0.f)
-            FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnSprintStarted);
+        if(m_hot.m_sprintPrevValue == 0.f && !AZ::IsClose(m_hot.m_sprintVelocityAdjust, 1.f) && sprintHeldDuration < m_movementProfile->m_sprintMaxTime && !m_hot.m_sprintCoolingDown)
+            Notify(NotificationEvent::SprintStarted);
 
-        m_sprintPrevValue = m_sprintValue;
+        m_hot.m_sprintPrevValue = m_sprintValue;
 
         // If sprint is to be applied then increment the sprint counter
-        if(!AZ::IsClose(m_sprintVelocityAdjust, 1.f) && m_sprintHeldDuration < m_sprintMaxTime && m_sprintCooldown == 0.f)
+        if(!AZ::IsClose(m_hot.m_sprintVelocityAdjust, 1.f) && sprintHeldDuration < m_movementProfile->m_sprintMaxTime && !m_hot.m_sprintCoolingDown)
         {
-            m_staminaIncreasing = false;
+            m_hot.m_staminaIncreasing = false;
+
+            // Stop regenerating at the held duration reached so far
+            if(!m_hot.m_sprintDraining)
+            {
+                FoldSprintHeldDuration();
+                m_hot.m_sprintDraining = true;
+            }
 
             // Cause the character to stand if trying to sprint while crouched and the setting is enabled
-            if(m_crouchSprintCausesStanding && m_crouched)
-                m_crouching = false;
+            if(m_crouchSprintCausesStanding && m_hot.m_crouched)
+                m_hot.m_crouching = false;
 
-            // Figure out which of the scaled sprint velocity directions is the greatest
-            float greatestSprintScale = 1.f;
-            for(const float scale: {m_sprintScaleForward, m_sprintScaleBack, m_sprintScaleLeft, m_sprintScaleRight})
-                if(abs(scale) > abs(greatestSprintScale))
-                        greatestSprintScale = scale;
+            // The greatest of the scaled sprint velocity directions
+            const float greatestSprintScale = m_derived.m_greatestSprintScale;
 
-            if(m_sprintAccelValue >= 1.f)
+            if(m_hot.m_sprintAccelValue >= 1.f)
             {
                 if(greatestSprintScale >= 1.f)
-                    m_sprintAccelAdjust = (m_sprintAccelValue - 1.f)/(greatestSprintScale - 1.f) * (m_sprintVelocityAdjust - 1.f) + 1.f;
+                    m_hot.m_sprintAccelAdjust = (m_hot.m_sprintAccelValue - 1.f)/(greatestSprintScale - 1.f) * (m_hot.m_sprintVelocityAdjust - 1.f) + 1.f;
                 else
-                    m_sprintAccelAdjust = (m_sprintAccelValue - 1.f)/(greatestSprintScale) * (m_sprintVelocityAdjust) + 1.f;
+                    m_hot.m_sprintAccelAdjust = (m_hot.m_sprintAccelValue - 1.f)/(greatestSprintScale) * (m_hot.m_sprintVelocityAdjust) + 1.f;
             }
             else
             {
                 if(greatestSprintScale >= 1.f)
-                    m_sprintAccelAdjust = (m_sprintAccelValue)/(greatestSprintScale - 1.f) * (m_sprintVelocityAdjust - 1.f);
+                    m_hot.m_sprintAccelAdjust = (m_hot.m_sprintAccelValue)/(greatestSprintScale - 1.f) * (m_hot.m_sprintVelocityAdjust - 1.f);
                 else
-                    m_sprintAccelAdjust = (m_sprintAccelValue)/(greatestSprintScale) * (m_sprintVelocityAdjust);
+                    m_hot.m_sprintAccelAdjust = (m_hot.m_sprintAccelValue)/(greatestSprintScale) * (m_hot.m_sprintVelocityAdjust);
             }
 
             if(m_sprintUsesStamina)
             {
-                m_staminaDecreasing = true;
-                m_sprintHeldDuration += deltaTime * (m_sprintVelocityAdjust-1.f)/(greatestSprintScale-1.f);
+                m_hot.m_staminaDecreasing = true;
+                m_hot.m_sprintHeldDuration += deltaTime * (m_hot.m_sprintVelocityAdjust-1.f)/(greatestSprintScale-1.f);
             }
 
-            if(m_sprintHeldDuration >= m_sprintMaxTime)
+            if(m_hot.m_sprintHeldDuration >= m_movementProfile->m_sprintMaxTime)
             {
-                m_sprintHeldDuration = m_sprintMaxTime;
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStaminaReachedZero);
+                m_hot.m_sprintHeldDuration = m_movementProfile->m_sprintMaxTime;
+                Notify(NotificationEvent::StaminaReachedZero);
             }
+            m_hot.m_sprintHeldDurationTime = now;
 
-            m_sprintPause = m_sprintPauseTime;
+            // The pause before regeneration starts counting down from the last step that sprinted
+            m_hot.m_sprintPauseEnd = now + m_sprintPauseTime;
 
-            m_sprintPrevVelocityLength = m_applyVelocityXY.GetLength();
+            m_hot.m_sprintPrevVelocityLength = m_hot.m_applyVelocityXY.GetLength();
         }
         // Otherwise if the sprint velocity isn't applied then decrement the sprint counter
         else
         {
-            m_staminaDecreasing = false;
+            m_hot.m_staminaDecreasing = false;
+            m_hot.m_sprintDraining = false;
 
             m_sprintValue = 0.f;
 
             // Set the sprint acceleration adjust according to the local direction the character is moving
-            if(!m_sprintStopAccelAdjustCaptured && targetVelocityXY.IsZero())
+            if(!m_hot.m_sprintStopAccelAdjustCaptured && targetVelocityXY.IsZero())
             {
-                // Figure out which of the scaled sprint velocity directions is the greatest
-                float greatestSprintScale = 0.f;
-                for(const float scale: {m_sprintScaleForward, m_sprintScaleBack, m_sprintScaleLeft, m_sprintScaleRight})
-                    if(abs(scale) > abs(greatestSprintScale))
-                            greatestSprintScale = scale;
+                // The greatest of the scaled sprint velocity directions
+                const float greatestSprintScale = m_derived.m_greatestSprintScaleOrZero;
 
                 float lastAdjustScale = 1.f;
                 if(m_instantVelocityRotation)
                 {
                     if(m_velocityXCrossYDirection.GetZ() >= 0.f)
-                        lastAdjustScale = CreateEllipseScaledVector(m_prevTargetVelocityXY.GetNormalized(), m_sprintScaleForward, m_sprintScaleBack, m_sprintScaleLeft, m_sprintScaleRight).GetLength();
+                        lastAdjustScale = CreateEllipseScaledVector(m_hot.m_prevTargetVelocityXY.GetNormalized(), m_movementProfile->m_sprintScaleForward, m_movementProfile->m_sprintScaleBack, m_movementProfile->m_sprintScaleLeft, m_movementProfile->m_sprintScaleRight).GetLength();
                     else
-                        lastAdjustScale = CreateEllipseScaledVector((-m_prevTargetVelocityXY).GetNormalized(), m_sprintScaleForward, m_sprintScaleBack, m_sprintScaleLeft, m_sprintScaleRight).GetLength();
+                        lastAdjustScale = CreateEllipseScaledVector((-m_hot.m_prevTargetVelocityXY).GetNormalized(), m_movementProfile->m_sprintScaleForward, m_movementProfile->m_sprintScaleBack, m_movementProfile->m_sprintScaleLeft, m_movementProfile->m_sprintScaleRight).GetLength();
                 }
                 else
                 {
                     if(m_velocityXCrossYDirection.GetZ() >= 0.f)
-                        lastAdjustScale = CreateEllipseScaledVector(AZ::Vector2(AZ::Quaternion::CreateRotationZ(-m_currentHeading).TransformVector(AZ::Vector3(m_prevTargetVelocityXY)).GetNormalized()), m_sprintScaleForward, m_sprintScaleBack, m_sprintScaleLeft, m_sprintScaleRight).GetLength();
+                        lastAdjustScale = CreateEllipseScaledVector(AZ::Vector2(AZ::Quaternion::CreateRotationZ(-m_hot.m_currentHeading).TransformVector(AZ::Vector3(m_hot.m_prevTargetVelocityXY)).GetNormalized()), m_movementProfile->m_sprintScaleForward, m_movementProfile->m_sprintScaleBack, m_movementProfile->m_sprintScaleLeft, m_movementProfile->m_sprintScaleRight).GetLength();
                     else
-                        lastAdjustScale = CreateEllipseScaledVector(AZ::Vector2(AZ::Quaternion::CreateRotationZ(-m_currentHeading).TransformVector(AZ::Vector3(-m_prevTargetVelocityXY)).GetNormalized()), m_sprintScaleForward, m_sprintScaleBack, m_sprintScaleLeft, m_sprintScaleRight).GetLength();
+                        lastAdjustScale = CreateEllipseScaledVector(AZ::Vector2(AZ::Quaternion::CreateRotationZ(-m_hot.m_currentHeading).TransformVector(AZ::Vector3(-m_hot.m_prevTargetVelocityXY)).GetNormalized()), m_movementProfile->m_sprintScaleForward, m_movementProfile->m_sprintScaleBack, m_movementProfile->m_sprintScaleLeft, m_movementProfile->m_sprintScaleRight).GetLength();
                 }
 
-                if(m_sprintAccelValue >= 1.f)
+                if(m_hot.m_sprintAccelValue >= 1.f)
                 {
                     if(greatestSprintScale >= 1.f)
-                        m_sprintAccelAdjust = (m_sprintAccelValue - 1.f)/(greatestSprintScale - 1.f) * (lastAdjustScale - 1.f) + 1.f;
+                        m_hot.m_sprintAccelAdjust = (m_hot.m_sprintAccelValue - 1.f)/(greatestSprintScale - 1.f) * (lastAdjustScale - 1.f) + 1.f;
                     else
-                        m_sprintAccelAdjust = (m_sprintAccelValue - 1.f)/(greatestSprintScale) * (lastAdjustScale) + 1.f;
+                        m_hot.m_sprintAccelAdjust = (m_hot.m_sprintAccelValue - 1.f)/(greatestSprintScale) * (lastAdjustScale) + 1.f;
                 }
                 else
                 {
                     if(greatestSprintScale >= 1.f)
-                        m_sprintAccelAdjust = (m_sprintAccelValue)/(greatestSprintScale - 1.f) * (lastAdjustScale - 1.f);
+                        m_hot.m_sprintAccelAdjust = (m_hot.m_sprintAccelValue)/(greatestSprintScale - 1.f) * (lastAdjustScale - 1.f);
                     else
-                        m_sprintAccelAdjust = (m_sprintAccelValue)/(greatestSprintScale) * (lastAdjustScale);
+                        m_hot.m_sprintAccelAdjust = (m_hot.m_sprintAccelValue)/(greatestSprintScale) * (lastAdjustScale);
                 }
 
-                m_sprintStopAccelAdjustCaptured = true;
+                m_hot.m_sprintStopAccelAdjustCaptured = true;
             }
-            else if(AZ::IsClose(m_sprintAccumulatedAccel, 0.f) && AZ::IsClose(m_sprintVelocityAdjust, 1.f))
-                m_sprintAccumulatedAccel = 0.f;
+            else if(AZ::IsClose(m_hot.m_sprintAccumulatedAccel, 0.f) && AZ::IsClose(m_hot.m_sprintVelocityAdjust, 1.f))
+                m_hot.m_sprintAccumulatedAccel = 0.f;
 
-            if(m_sprintAccumulatedAccel <= 0.f)
+            if(m_hot.m_sprintAccumulatedAccel <= 0.f)
             {
-                m_sprintPrevVelocityLength = 0.f;
-                m_sprintStopAccelAdjustCaptured = false;
-                m_sprintAccelAdjust = 1.f;
+                m_hot.m_sprintPrevVelocityLength = 0.f;
+                m_hot.m_sprintStopAccelAdjustCaptured = false;
+                m_hot.m_sprintAccelAdjust = 1.f;
             }
 
-            // When the sprint held duration exceeds the maximum sprint time then initiate the cooldown period
-            if(m_sprintHeldDuration >= m_sprintMaxTime && m_sprintCooldown == 0.f)
+            // When the sprint held duration exceeds the maximum sprint time then initiate the cooldown period,
+            // which counts down from the start of this step
+            if(m_hot.m_sprintHeldDuration >= m_movementProfile->m_sprintMaxTime && !m_hot.m_sprintCoolingDown)
             {
-                m_sprintVelocityAdjust = 1.f;
-                m_sprintCooldown = m_sprintCooldownTime;
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnCooldownStarted);
+                m_hot.m_sprintVelocityAdjust = 1.f;
+                m_hot.m_sprintCoolingDown = true;
+                m_hot.m_sprintCooldownEnd = now - deltaTime + m_movementProfile->m_sprintCooldownTime;
+                Notify(NotificationEvent::CooldownStarted);
             }
 
-            m_sprintPause -= deltaTime;
-            if(m_sprintPause < 0.f)
-                m_sprintPause = 0.f;
-
-            if(m_sprintPause == 0.f && m_sprintCooldown == 0.f && m_regenerateStaminaAutomatically && m_sprintHeldDuration > 0.f)
+            // The held duration decreases once the pause has ended at a rate which makes it so that the stamina
+            // will regenerate when nearly depleted at the same time it would take if you were just wait through
+            // the cooldown time. Only the time at which it reaches zero needs to be checked here.
+            if(StaminaRegenerates() && m_hot.m_sprintHeldDuration > 0.f && now >= AZStd::max(m_hot.m_sprintHeldDurationTime, m_hot.m_sprintPauseEnd))
             {
-                // Decrement the sprint held duration at a rate which makes it so that the stamina
-                // will regenerate when nearly depleted at the same time it would take if you were
-                // just wait through the cooldown time.
-                // Decrement this value by only deltaTime if you wish to instead use m_sprintPause
-                // to achieve the same timing but instead through the use of a pause.
-                m_sprintHeldDuration -= deltaTime * ((m_sprintMaxTime+m_sprintPauseTime)/m_sprintCooldownTime) * m_sprintRegenRate;
-                m_staminaIncreasing = true;
+                m_hot.m_staminaIncreasing = true;
 
-                if(m_sprintHeldDuration <= 0.f)
+                if(now >= GetStaminaCappedTime())
                 {
-                    m_sprintHeldDuration = 0.f;
-                    FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStaminaCapped);
+                    m_hot.m_sprintHeldDuration = 0.f;
+                    m_hot.m_sprintHeldDurationTime = now;
+                    Notify(NotificationEvent::StaminaCapped);
                 }
             }
             else
-                m_staminaIncreasing = false;
+                m_hot.m_staminaIncreasing = false;
 
-            if(m_sprintCooldown != 0.f)
+            if(m_hot.m_sprintCoolingDown && now >= m_hot.m_sprintCooldownEnd)
             {
-                m_sprintCooldown -= deltaTime;
-                if(m_sprintCooldown <= 0.f)
+                m_hot.m_sprintCoolingDown = false;
+                m_hot.m_sprintPauseEnd = now;
+                Notify(NotificationEvent::CooldownDone);
+                if(m_regenerateStaminaAutomatically)
                 {
-                    m_sprintCooldown = 0.f;
-                    m_sprintPause = 0.f;
-                    FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnCooldownDone);
-                    if(m_regenerateStaminaAutomatically)
-                    {
-                        m_sprintHeldDuration = 0.f;
-                        m_staminaIncreasing = true;
-                        FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStaminaCapped);
-                    }
+                    m_hot.m_sprintHeldDuration = 0.f;
+                    m_hot.m_sprintHeldDurationTime = now;
+                    m_hot.m_staminaIncreasing = true;
+                    Notify(NotificationEvent::StaminaCapped);
                 }
             }
         }
-
-        if(m_sprintMaxTime != 0.f)
-            m_staminaPercentage = 100.f * (m_sprintMaxTime - m_sprintHeldDuration) / m_sprintMaxTime;
-        else
-            m_staminaPercentage = 0.f;
-        //AZ_Printf("", "Stamina = %.10f\%", m_staminaPercentage);
     }
 
     void FirstPersonControllerComponent::CrouchManager(const float& deltaTime)
@@ -1335,19 +2073,19 @@ namespace FirstPersonController
 
         AZ::TransformInterface* cameraTransform = m_activeCameraEntity->GetTransform();
 
-        if(m_crouchEnableToggle && !m_crouchScriptLocked && m_crouchPrevValue == 0.f && m_crouchValue == 1.f)
+        if(m_crouchEnableToggle && !m_crouchScriptLocked && m_hot.m_crouchPrevValue == 0.f && m_crouchValue == 1.f)
         {
-            m_crouching = !m_crouching;
+            m_hot.m_crouching = !m_hot.m_crouching;
         }
         else if(!m_crouchEnableToggle && !m_crouchScriptLocked)
         {
             if(m_crouchValue != 0.f
                  && ((m_sprintValue == 0.f || !m_crouchSprintCausesStanding)
-                  || ((m_crouchPriorityWhenSprintPressed) && (m_standing || (m_crouching && !m_crouched))))
-                 && (m_jumpValue == 0.f || !m_crouchJumpCausesStanding || (m_jumpReqRepress && (m_standing || m_crouching))))
-                m_crouching = true;
+                  || ((m_crouchPriorityWhenSprintPressed) && (m_hot.m_standing || (m_hot.m_crouching && !m_hot.m_crouched))))
+                 && (m_jumpValue == 0.f || !m_crouchJumpCausesStanding || (m_hot.m_jumpReqRepress && (m_hot.m_standing || m_hot.m_crouching))))
+                m_hot.m_crouching = true;
             else
-                m_crouching = false;
+                m_hot.m_crouching = false;
         }
 
         // If the crouch key takes priority when the sprint key is held and we're attempting to crouch
@@ -1355,41 +2093,41 @@ namespace FirstPersonController
         if(m_crouchPriorityWhenSprintPressed
                 && !m_sprintWhileCrouched
                 && m_sprintValue != 0.f
-                && m_crouching
-                && m_cameraLocalZTravelDistance > -1.f * m_crouchDistance)
+                && m_hot.m_crouching
+                && m_hot.m_cameraLocalZTravelDistance > -1.f * m_derived.m_crouchDistance)
             m_sprintValue = 0.f;
         // Otherwise if the crouch key does not take priority when the sprint key is held,
         // and we are attempting to crouch while the sprint key is held, then do not crouch
         else if(!m_crouchPriorityWhenSprintPressed
             && m_sprintValue != 0.f
-            && m_crouching
-            && m_cameraLocalZTravelDistance > -1.f * m_crouchDistance)
-           m_crouching = false;
+            && m_hot.m_crouching
+            && m_hot.m_cameraLocalZTravelDistance > -1.f * m_derived.m_crouchDistance)
+           m_hot.m_crouching = false;
 
-        //AZ_Printf("", "m_crouching = %s", m_crouching ? "true" : "false");
+        //AZ_Printf("", "m_hot.m_crouching = %s", m_hot.m_crouching ? "true" : "false");
 
         // Crouch down
-        if(m_crouching && m_cameraLocalZTravelDistance > -1.f * m_crouchDistance)
+        if(m_hot.m_crouching && m_hot.m_cameraLocalZTravelDistance > -1.f * m_derived.m_crouchDistance)
         {
-            if(m_standing)
-                m_standing = false;
+            if(m_hot.m_standing)
+                m_hot.m_standing = false;
 
-            if(m_cameraLocalZTravelDistance == 0.f)
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStartedCrouching);
+            if(m_hot.m_cameraLocalZTravelDistance == 0.f)
+                Notify(NotificationEvent::StartedCrouching);
 
-            float cameraTravelDelta = -1.f * m_crouchDistance * deltaTime / m_crouchTime;
-            m_cameraLocalZTravelDistance += cameraTravelDelta;
+            float cameraTravelDelta = -1.f * m_derived.m_crouchDistance * deltaTime / m_movementProfile->m_crouchTime;
+            m_hot.m_cameraLocalZTravelDistance += cameraTravelDelta;
 
-            if(m_cameraLocalZTravelDistance <= -1.f * m_crouchDistance)
+            if(m_hot.m_cameraLocalZTravelDistance <= -1.f * m_derived.m_crouchDistance)
             {
-                cameraTravelDelta += abs(m_cameraLocalZTravelDistance) - m_crouchDistance;
-                m_cameraLocalZTravelDistance = -1.f * m_crouchDistance;
-                m_crouched = true;
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnCrouched);
+                cameraTravelDelta += abs(m_hot.m_cameraLocalZTravelDistance) - m_derived.m_crouchDistance;
+                m_hot.m_cameraLocalZTravelDistance = -1.f * m_derived.m_crouchDistance;
+                m_hot.m_crouched = true;
+                Notify(NotificationEvent::Crouched);
             }
 
             // Adjust the height of the collider capsule based on the crouching height
-            PhysX::CharacterControllerRequestBus::EventResult(m_capsuleCurrentHeight, GetEntityId(),
+            PhysX::CharacterControllerRequestBus::EventResult(m_hot.m_capsuleCurrentHeight, GetEntityId(),
                 &PhysX::CharacterControllerRequestBus::Events::GetHeight);
 
             float stepHeight = 0.f;
@@ -1397,26 +2135,26 @@ namespace FirstPersonController
                 &Physics::CharacterRequestBus::Events::GetStepHeight);
 
             // Subtract the distance to get down to the crouching height
-            m_capsuleCurrentHeight += cameraTravelDelta;
-            if(m_capsuleCurrentHeight < (2.f*m_capsuleRadius + 0.00001f))
-                m_capsuleCurrentHeight = 2.f*m_capsuleRadius + 0.00001f;
-            if(m_capsuleCurrentHeight < (stepHeight + 0.00001f))
-                m_capsuleCurrentHeight = stepHeight + 0.00001f;
-            //AZ_Printf("", "Crouching capsule height = %.10f", m_capsuleCurrentHeight);
+            m_hot.m_capsuleCurrentHeight += cameraTravelDelta;
+            if(m_hot.m_capsuleCurrentHeight < (2.f*m_capsuleRadius + 0.00001f))
+                m_hot.m_capsuleCurrentHeight = 2.f*m_capsuleRadius + 0.00001f;
+            if(m_hot.m_capsuleCurrentHeight < (stepHeight + 0.00001f))
+                m_hot.m_capsuleCurrentHeight = stepHeight + 0.00001f;
+            //AZ_Printf("", "Crouching capsule height = %.10f", m_hot.m_capsuleCurrentHeight);
 
             PhysX::CharacterControllerRequestBus::Event(GetEntityId(),
-                &PhysX::CharacterControllerRequestBus::Events::Resize, m_capsuleCurrentHeight);
+                &PhysX::CharacterControllerRequestBus::Events::Resize, m_hot.m_capsuleCurrentHeight);
 
             cameraTransform->SetLocalZ(cameraTransform->GetLocalZ() + cameraTravelDelta);
         }
         // Stand up
-        else if(!m_crouching && m_cameraLocalZTravelDistance != 0.f)
+        else if(!m_hot.m_crouching && m_hot.m_cameraLocalZTravelDistance != 0.f)
         {
-            if(m_crouched)
-                m_crouched = false;
+            if(m_hot.m_crouched)
+                m_hot.m_crouched = false;
 
-            if(m_cameraLocalZTravelDistance == -1.f * m_crouchDistance)
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStartedStanding);
+            if(m_hot.m_cameraLocalZTravelDistance == -1.f * m_derived.m_crouchDistance)
+                Notify(NotificationEvent::StartedStanding);
 
             // Create a shapecast sphere that will be used to detect whether there is an obstruction
             // above the players head, and prevent them from fully standing up if there is
@@ -1425,7 +2163,7 @@ namespace FirstPersonController
             AZ::Transform sphereCastPose = AZ::Transform::CreateIdentity();
 
             // Move the sphere to the location of the character and apply the Z offset
-            sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Vector3::CreateAxisZ(m_capsuleCurrentHeight - m_capsuleRadius));
+            sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Vector3::CreateAxisZ(m_hot.m_capsuleCurrentHeight - m_capsuleRadius));
 
             AZ::Vector3 sphereCastDirection = AZ::Vector3::CreateAxisZ();
 
@@ -1434,9 +2172,9 @@ namespace FirstPersonController
             {
                 sphereCastDirection = m_sphereCastsAxisDirectionPose;
                 if(m_sphereCastsAxisDirectionPose.GetZ() >= 0.f)
-                    sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(), m_sphereCastsAxisDirectionPose).TransformVector(AZ::Vector3::CreateAxisZ(m_capsuleCurrentHeight - m_capsuleRadius)));
+                    sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(), m_sphereCastsAxisDirectionPose).TransformVector(AZ::Vector3::CreateAxisZ(m_hot.m_capsuleCurrentHeight - m_capsuleRadius)));
                 else
-                    sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(-1.f), m_sphereCastsAxisDirectionPose).TransformVector(-AZ::Vector3::CreateAxisZ(m_capsuleCurrentHeight - m_capsuleRadius)));
+                    sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(-1.f), m_sphereCastsAxisDirectionPose).TransformVector(-AZ::Vector3::CreateAxisZ(m_hot.m_capsuleCurrentHeight - m_capsuleRadius)));
             }
 
             AzPhysics::ShapeCastRequest request = AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
@@ -1451,8 +2189,14 @@ namespace FirstPersonController
 
             request.m_reportMultipleHits = true;
 
+            // Otherwise the result of the query made earlier on this frame is reused
+            const bool runQuery = !m_standQueryOncePerFrame || m_standQueryFrame != m_frameCounter;
+            m_standQueryFrame = m_frameCounter;
+
             AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
-            AzPhysics::SceneQueryHits hits = sceneInterface->QueryScene(sceneHandle, &request);
+            AzPhysics::SceneQueryHits hits;
+            if(runQuery)
+                hits = sceneInterface->QueryScene(sceneHandle, &request);
 
             // Disregard intersections with the character's collider and its child entities,
             auto selfChildEntityCheck = [this](AzPhysics::SceneQueryHit& hit)
@@ -1489,63 +2233,70 @@ namespace FirstPersonController
                     return false;
                 };
 
-            AZStd::erase_if(hits.m_hits, selfChildEntityCheck);
+            if(runQuery)
+            {
+                AZStd::erase_if(hits.m_hits, selfChildEntityCheck);
 
-            m_standPreventedEntityIds.clear();
-            if(hits)
-                for(AzPhysics::SceneQueryHit hit: hits.m_hits)
+                m_standPreventedEntityIds.clear();
+                for(const AzPhysics::SceneQueryHit& hit: hits.m_hits)
                     m_standPreventedEntityIds.push_back(hit.m_entityId);
 
+                m_standPreventedImpact = FirstPersonControllerImpact();
+                if(const AzPhysics::SceneQueryHit* nearestHit = FindNearestHit(hits.m_hits))
+                    m_standPreventedImpact = CreateImpact(*nearestHit, m_hot.m_prevTargetVelocity);
+            }
+
             // Bail if something is detected above the player
-            if(hits || m_standPreventedViaScript)
+            if(!m_standPreventedEntityIds.empty() || m_hot.m_standPreventedViaScript)
             {
-                m_crouchPrevValue = m_crouchValue;
-                m_standPrevented = true;
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStandPrevented);
+                m_hot.m_crouchPrevValue = m_crouchValue;
+                m_hot.m_standPrevented = true;
+                Notify(NotificationEvent::StandPrevented);
+                NotifyImpact(NotificationEvent::StandPreventedWithImpact, m_standPreventedImpact);
                 return;
             }
-            m_standPrevented = false;
+            m_hot.m_standPrevented = false;
 
-            float cameraTravelDelta = m_crouchDistance * deltaTime / m_standTime;
-            m_cameraLocalZTravelDistance += cameraTravelDelta;
+            float cameraTravelDelta = m_derived.m_crouchDistance * deltaTime / m_movementProfile->m_standTime;
+            m_hot.m_cameraLocalZTravelDistance += cameraTravelDelta;
 
-            if(m_cameraLocalZTravelDistance >= 0.f)
+            if(m_hot.m_cameraLocalZTravelDistance >= 0.f)
             {
-                cameraTravelDelta -= m_cameraLocalZTravelDistance;
-                m_cameraLocalZTravelDistance = 0.f;
-                m_standing = true;
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStoodUp);
+                cameraTravelDelta -= m_hot.m_cameraLocalZTravelDistance;
+                m_hot.m_cameraLocalZTravelDistance = 0.f;
+                m_hot.m_standing = true;
+                Notify(NotificationEvent::StoodUp);
             }
 
             // Adjust the height of the collider capsule based on the standing height
-            PhysX::CharacterControllerRequestBus::EventResult(m_capsuleCurrentHeight, GetEntityId(),
+            PhysX::CharacterControllerRequestBus::EventResult(m_hot.m_capsuleCurrentHeight, GetEntityId(),
                 &PhysX::CharacterControllerRequestBus::Events::GetHeight);
 
             // Add the distance to get back to the standing height
-            m_capsuleCurrentHeight += cameraTravelDelta;
-            if(m_capsuleCurrentHeight > m_capsuleHeight)
-                m_capsuleCurrentHeight = m_capsuleHeight;
-            //AZ_Printf("", "Standing capsule height = %.10f", m_capsuleCurrentHeight);
+            m_hot.m_capsuleCurrentHeight += cameraTravelDelta;
+            if(m_hot.m_capsuleCurrentHeight > m_capsuleHeight)
+                m_hot.m_capsuleCurrentHeight = m_capsuleHeight;
+            //AZ_Printf("", "Standing capsule height = %.10f", m_hot.m_capsuleCurrentHeight);
 
             PhysX::CharacterControllerRequestBus::Event(GetEntityId(),
-                &PhysX::CharacterControllerRequestBus::Events::Resize, m_capsuleCurrentHeight);
+                &PhysX::CharacterControllerRequestBus::Events::Resize, m_hot.m_capsuleCurrentHeight);
 
             cameraTransform->SetLocalZ(cameraTransform->GetLocalZ() + cameraTravelDelta);
         }
 
-        m_crouchPrevValue = m_crouchValue;
+        m_hot.m_crouchPrevValue = m_crouchValue;
     }
 
     void FirstPersonControllerComponent::UpdateVelocityXY(const float& deltaTime)
     {
-        float forwardBack = m_forwardValue * m_forwardScale + -1.f * m_backValue * m_backScale;
-        float leftRight = -1.f * m_leftValue * m_leftScale + m_rightValue * m_rightScale;
+        float forwardBack = m_forwardValue * m_movementProfile->m_forwardScale + -1.f * m_backValue * m_movementProfile->m_backScale;
+        float leftRight = -1.f * m_leftValue * m_movementProfile->m_leftScale + m_rightValue * m_movementProfile->m_rightScale;
 
         // Remove the scale factor since it's going to be applied after the normalization
         if(forwardBack >= 0.f)
-            forwardBack /= m_forwardScale;
+            forwardBack /= m_movementProfile->m_forwardScale;
         else
-            forwardBack /= m_backScale;
+            forwardBack /= m_movementProfile->m_backScale;
 
         // If the character is being flipped upside-down then flip the X&Y movement
         if(m_velocityXCrossYDirection.GetZ() < 0.f)
@@ -1555,9 +2306,9 @@ namespace FirstPersonController
         }
 
         if(leftRight >= 0.f)
-            leftRight /= m_rightScale;
+            leftRight /= m_movementProfile->m_rightScale;
         else
-            leftRight /= m_leftScale;
+            leftRight /= m_movementProfile->m_leftScale;
 
         AZ::Vector2 targetVelocityXY = AZ::Vector2(leftRight, forwardBack);
 
@@ -1566,21 +2317,21 @@ namespace FirstPersonController
             targetVelocityXY.Normalize();
 
         if(m_velocityXCrossYDirection.GetZ() >= 0.f)
-            targetVelocityXY = CreateEllipseScaledVector(targetVelocityXY, m_forwardScale, m_backScale, m_leftScale, m_rightScale);
+            targetVelocityXY = CreateEllipseScaledVector(targetVelocityXY, m_movementProfile->m_forwardScale, m_movementProfile->m_backScale, m_movementProfile->m_leftScale, m_movementProfile->m_rightScale);
         else
-            targetVelocityXY = -CreateEllipseScaledVector((-targetVelocityXY), m_forwardScale, m_backScale, m_leftScale, m_rightScale);
+            targetVelocityXY = -CreateEllipseScaledVector((-targetVelocityXY), m_movementProfile->m_forwardScale, m_movementProfile->m_backScale, m_movementProfile->m_leftScale, m_movementProfile->m_rightScale);
 
         // Call the sprint manager
         if(!m_scriptSetsTargetVelocityXY)
             SprintManager(targetVelocityXY, deltaTime);
 
         // Apply the speed, sprint factor, and crouch factor
-        if(m_standing)
-            targetVelocityXY *= m_speed * m_sprintVelocityAdjust;
-        else if(m_sprintWhileCrouched && !m_standing)
-            targetVelocityXY *= m_speed * m_sprintVelocityAdjust * m_crouchScale;
+        if(m_hot.m_standing)
+            targetVelocityXY *= m_movementProfile->m_topWalkSpeed * m_hot.m_sprintVelocityAdjust;
+        else if(m_sprintWhileCrouched && !m_hot.m_standing)
+            targetVelocityXY *= m_movementProfile->m_topWalkSpeed * m_hot.m_sprintVelocityAdjust * m_movementProfile->m_crouchScale;
         else
-            targetVelocityXY *= m_speed * m_crouchScale;
+            targetVelocityXY *= m_movementProfile->m_topWalkSpeed * m_movementProfile->m_crouchScale;
 
         if(m_scriptSetsTargetVelocityXY)
         {
@@ -1592,81 +2343,98 @@ namespace FirstPersonController
             m_scriptTargetVelocityXY = targetVelocityXY;
 
         // Rotate the target velocity vector so that it can be compared against the applied velocity
-        AZ::Vector2 targetVelocityXYWorld = AZ::Vector2(AZ::Quaternion::CreateRotationZ(m_currentHeading).TransformVector(AZ::Vector3(targetVelocityXY)));
+        float targetVelocityXWorld, targetVelocityYWorld;
+        RotateXY(targetVelocityXY.GetX(), targetVelocityXY.GetY(), m_hot.m_currentHeading, targetVelocityXWorld, targetVelocityYWorld);
+        const AZ::Vector2 targetVelocityXYWorld = AZ::Vector2(targetVelocityXWorld, targetVelocityYWorld);
 
         // Obtain the last applied velocity if the target velocity changed
-        if((m_instantVelocityRotation ? (m_prevTargetVelocityXY != targetVelocityXY)
-                                        : (m_prevTargetVelocityXY != targetVelocityXYWorld))
-            || (!m_velocityXYIgnoresObstacles && m_hitSomething)
+        if((m_instantVelocityRotation ? (m_hot.m_prevTargetVelocityXY != targetVelocityXY)
+                                        : (m_hot.m_prevTargetVelocityXY != targetVelocityXYWorld))
+            || (!m_velocityXYIgnoresObstacles && m_hot.m_hitSomething)
             || (AZ::GetSign(m_prevVelocityXCrossYDirection.GetZ()) != AZ::GetSign(m_velocityXCrossYDirection.GetZ())))
         {
             if(m_instantVelocityRotation)
             {
                 // Set the previous target velocity to the new one
-                m_prevTargetVelocityXY = targetVelocityXY;
+                m_hot.m_prevTargetVelocityXY = targetVelocityXY;
                 // Store the last applied velocity to be used for the lerping
-                if(!m_velocityXYIgnoresObstacles && m_hitSomething)
+                if(!m_velocityXYIgnoresObstacles && m_hot.m_hitSomething)
                 {
-                    m_applyVelocityXY = AZ::Vector2(m_correctedVelocityXY);
-                    m_correctedVelocityXY = AZ::Vector2::CreateZero();
+                    m_hot.m_applyVelocityXY = AZ::Vector2(m_hot.m_correctedVelocityXY);
+                    m_hot.m_correctedVelocityXY = AZ::Vector2::CreateZero();
+                    m_hot.m_analyticVelocityRestart = true;
                 }
-                m_prevApplyVelocityXY = AZ::Vector2(AZ::Quaternion::CreateRotationZ(-m_currentHeading).TransformVector(AZ::Vector3(m_applyVelocityXY)));
+                float prevApplyVelocityX, prevApplyVelocityY;
+                RotateXY(m_hot.m_applyVelocityXY.GetX(), m_hot.m_applyVelocityXY.GetY(), -m_hot.m_currentHeading, prevApplyVelocityX, prevApplyVelocityY);
+                m_hot.m_prevApplyVelocityXY = AZ::Vector2(prevApplyVelocityX, prevApplyVelocityY);
             }
             else
             {
                 // Set the previous target velocity to the new one
-                m_prevTargetVelocityXY = targetVelocityXYWorld;
+                m_hot.m_prevTargetVelocityXY = targetVelocityXYWorld;
                 // Store the last applied velocity to be used for the lerping
-                if(!m_velocityXYIgnoresObstacles && m_hitSomething)
-                    m_applyVelocityXY = AZ::Vector2(m_correctedVelocityXY);
+                if(!m_velocityXYIgnoresObstacles && m_hot.m_hitSomething)
+                {
+                    m_hot.m_applyVelocityXY = AZ::Vector2(m_hot.m_correctedVelocityXY);
+                    m_hot.m_analyticVelocityRestart = true;
+                }
 
-                m_prevApplyVelocityXY = m_applyVelocityXY;
+                m_hot.m_prevApplyVelocityXY = m_hot.m_applyVelocityXY;
             }
 
-            // Once the character's movement gets flipped on Z, m_prevApplyVelocityXY needs to be flipped,
+            // Once the character's movement gets flipped on Z, m_hot.m_prevApplyVelocityXY needs to be flipped,
             // so long as it hasn't occured around the world's X axis
             if(AZ::GetSign(m_prevVelocityXCrossYDirection.GetZ()) != AZ::GetSign(m_velocityXCrossYDirection.GetZ()) && !AZ::IsClose(m_velocityXCrossYDirection.GetY(), 0.f))
-                m_prevApplyVelocityXY *= -1.f;
+            {
+                m_hot.m_prevApplyVelocityXY *= -1.f;
+                m_hot.m_analyticVelocityXY *= -1.f;
+            }
 
             // Reset the lerp time since the target velocity changed
-            m_lerpTime = 0.f;
+            m_hot.m_lerpTime = 0.f;
         }
 
         m_prevVelocityXCrossYDirection = m_velocityXCrossYDirection;
 
         // Lerp to the velocity if we're not already there
-        if(m_applyVelocityXY != targetVelocityXYWorld)
+        if(m_hot.m_applyVelocityXY != targetVelocityXYWorld)
         {
             if(m_instantVelocityRotation)
-                m_applyVelocityXY = AZ::Vector2(AZ::Quaternion::CreateRotationZ(m_currentHeading).TransformVector(AZ::Vector3(LerpVelocityXY(targetVelocityXY, deltaTime))));
+            {
+                // Rotated the same way as the target velocity so that the two compare equal once the lerp completes
+                const AZ::Vector2 applyVelocityXY = m_analyticVelocityXY ? AnalyticVelocityXY(targetVelocityXY, deltaTime) : LerpVelocityXY(targetVelocityXY, deltaTime);
+                float applyVelocityX, applyVelocityY;
+                RotateXY(applyVelocityXY.GetX(), applyVelocityXY.GetY(), m_hot.m_currentHeading, applyVelocityX, applyVelocityY);
+                m_hot.m_applyVelocityXY = AZ::Vector2(applyVelocityX, applyVelocityY);
+            }
             else
-                m_applyVelocityXY = LerpVelocityXY(targetVelocityXYWorld, deltaTime);
+                m_hot.m_applyVelocityXY = m_analyticVelocityXY ? AnalyticVelocityXY(targetVelocityXYWorld, deltaTime) : LerpVelocityXY(targetVelocityXYWorld, deltaTime);
         }
         else
         {
-            m_accelerating = false;
-            m_decelerationFactorApplied = false;
-            m_opposingDecelFactorApplied = false;
+            m_hot.m_accelerating = false;
+            m_hot.m_decelerationFactorApplied = false;
+            m_hot.m_opposingDecelFactorApplied = false;
         }
 
         // Debug print statements to observe the velocity, acceleration, and position
-        //AZ_Printf("", "m_currentHeading = %.10f", m_currentHeading);
-        //AZ_Printf("", "m_applyVelocityXY.GetLength() = %.10f", m_applyVelocityXY.GetLength());
-        //AZ_Printf("", "m_applyVelocityXY.GetX() = %.10f", m_applyVelocityXY.GetX());
-        //AZ_Printf("", "m_applyVelocityXY.GetY() = %.10f", m_applyVelocityXY.GetY());
-        //AZ_Printf("", "m_sprintAccumulatedAccel = %.10f", m_sprintAccumulatedAccel);
+        //AZ_Printf("", "m_hot.m_currentHeading = %.10f", m_hot.m_currentHeading);
+        //AZ_Printf("", "m_hot.m_applyVelocityXY.GetLength() = %.10f", m_hot.m_applyVelocityXY.GetLength());
+        //AZ_Printf("", "m_hot.m_applyVelocityXY.GetX() = %.10f", m_hot.m_applyVelocityXY.GetX());
+        //AZ_Printf("", "m_hot.m_applyVelocityXY.GetY() = %.10f", m_hot.m_applyVelocityXY.GetY());
+        //AZ_Printf("", "m_hot.m_sprintAccumulatedAccel = %.10f", m_hot.m_sprintAccumulatedAccel);
         //AZ_Printf("", "m_sprintValue = %.10f", m_sprintValue);
-        //AZ_Printf("", "m_sprintAccelValue = %.10f", m_sprintAccelValue);
-        //AZ_Printf("", "m_sprintAccelAdjust = %.10f", m_sprintAccelAdjust);
-        //AZ_Printf("", "m_decelerationFactor = %.10f", m_decelerationFactor);
-        //AZ_Printf("", "m_sprintVelocityAdjust = %.10f", m_sprintVelocityAdjust);
-        //AZ_Printf("", "m_sprintHeldDuration = %.10f", m_sprintHeldDuration);
-        //AZ_Printf("", "m_sprintPause = %.10f", m_sprintPause);
+        //AZ_Printf("", "m_hot.m_sprintAccelValue = %.10f", m_hot.m_sprintAccelValue);
+        //AZ_Printf("", "m_hot.m_sprintAccelAdjust = %.10f", m_hot.m_sprintAccelAdjust);
+        //AZ_Printf("", "m_hot.m_decelerationFactor = %.10f", m_hot.m_decelerationFactor);
+        //AZ_Printf("", "m_hot.m_sprintVelocityAdjust = %.10f", m_hot.m_sprintVelocityAdjust);
+        //AZ_Printf("", "m_hot.m_sprintHeldDuration = %.10f", m_hot.m_sprintHeldDuration);
+        //AZ_Printf("", "GetSprintPause() = %.10f", GetSprintPause());
         //AZ_Printf("", "m_sprintPauseTime = %.10f", m_sprintPauseTime);
-        //AZ_Printf("", "m_sprintCooldown = %.10f", m_sprintCooldown);
-        //static AZ::Vector2 prevVelocity = m_applyVelocityXY;
-        //AZ_Printf("", "dv/dt = %.10f", prevVelocity.GetDistance(m_applyVelocityXY)/deltaTime);
-        //prevVelocity = m_applyVelocityXY;
+        //AZ_Printf("", "GetSprintCooldown() = %.10f", GetSprintCooldown());
+        //static AZ::Vector2 prevVelocity = m_hot.m_applyVelocityXY;
+        //AZ_Printf("", "dv/dt = %.10f", prevVelocity.GetDistance(m_hot.m_applyVelocityXY)/deltaTime);
+        //prevVelocity = m_hot.m_applyVelocityXY;
         //AZ::Vector3 pos = GetEntity()->GetTransform()->GetWorldTM().GetTranslation();
         //AZ_Printf("", "X Position = %.10f", pos.GetX());
         //AZ_Printf("", "Y Position = %.10f", pos.GetY());
@@ -1679,13 +2447,18 @@ namespace FirstPersonController
         auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
 
         // Used to determine when event notifications occur
-        const bool prevGrounded = m_grounded;
-        const bool prevGroundClose = m_groundClose;
+        const bool prevGrounded = m_hot.m_grounded;
+        const bool prevGroundClose = m_hot.m_groundClose;
+        const float prevAirTime = GetAirTime();
+
+        // Otherwise the results of the queries made earlier on this frame are reused
+        const bool runQueries = !m_groundQueriesOncePerFrame || m_groundQueryFrame != m_frameCounter;
+        m_groundQueryFrame = m_frameCounter;
 
         AZ::Transform sphereCastPose = AZ::Transform::CreateIdentity();
 
         // Move the sphere to the location of the character and apply the Z offset
-        sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Vector3::CreateAxisZ((1.f + m_groundSphereCastsRadiusPercentageIncrease/100.f)*m_capsuleRadius));
+        sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Vector3::CreateAxisZ(m_derived.m_groundSphereCastsRadius));
 
         AZ::Vector3 sphereCastDirection = AZ::Vector3::CreateAxisZ(-1.f);
 
@@ -1694,16 +2467,29 @@ namespace FirstPersonController
         {
             sphereCastDirection = -m_sphereCastsAxisDirectionPose;
             if(m_sphereCastsAxisDirectionPose.GetZ() > 0.f)
-                sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(), m_sphereCastsAxisDirectionPose).TransformVector(AZ::Vector3::CreateAxisZ((1.f + m_groundSphereCastsRadiusPercentageIncrease/100.f)*m_capsuleRadius)));
+                sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(), m_sphereCastsAxisDirectionPose).TransformVector(AZ::Vector3::CreateAxisZ(m_derived.m_groundSphereCastsRadius)));
             else
-                sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(-1.f), m_sphereCastsAxisDirectionPose).TransformVector(-AZ::Vector3::CreateAxisZ((1.f + m_groundSphereCastsRadiusPercentageIncrease/100.f)*m_capsuleRadius)));
+                sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(-1.f), m_sphereCastsAxisDirectionPose).TransformVector(-AZ::Vector3::CreateAxisZ(m_derived.m_groundSphereCastsRadius)));
+        }
+
+        // The vertical velocity at the end of the last step, which is used to predict the time to impact
+        const float velocityZ = m_hot.m_applyVelocityZ + (m_exactVelocityZ ? m_hot.m_applyVelocityZCurrentDelta : 0.f);
+        const VerticalMotionParams verticalMotionParams{m_movementProfile->m_gravity, m_movementProfile->m_jumpHeldGravityFactor, m_movementProfile->m_jumpFallingGravityFactor};
+
+        // When ground close is based on the time to impact, a single sweep covers the grounded offset
+        // plus the distance that can be fallen within the time threshold at the current fall speed
+        float groundSweepDistance = m_groundedSphereCastOffset;
+        if(m_groundCloseTimeToImpact)
+        {
+            float lookaheadVelocityZ = AZStd::min(velocityZ, 0.f);
+            groundSweepDistance -= IntegrateVerticalMotion(lookaheadVelocityZ, 0.f, m_groundCloseTimeThreshold, verticalMotionParams);
         }
 
         AzPhysics::ShapeCastRequest request = AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
-            (1.f + m_groundSphereCastsRadiusPercentageIncrease/100.f)*m_capsuleRadius,
+            m_derived.m_groundSphereCastsRadius,
             sphereCastPose,
             sphereCastDirection,
-            m_groundedSphereCastOffset,
+            groundSweepDistance,
             AzPhysics::SceneQuery::QueryType::StaticAndDynamic,
             m_groundedCollisionGroup,
             nullptr);
@@ -1711,7 +2497,9 @@ namespace FirstPersonController
         request.m_reportMultipleHits = true;
 
         AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
-        AzPhysics::SceneQueryHits hits = sceneInterface->QueryScene(sceneHandle, &request);
+        AzPhysics::SceneQueryHits hits;
+        if(runQueries)
+            hits = sceneInterface->QueryScene(sceneHandle, &request);
 
         AZStd::vector<AzPhysics::SceneQueryHit> steepNormals;
 
@@ -1736,15 +2524,19 @@ namespace FirstPersonController
                         return true;
                 }
 
-                if(abs(hit.m_normal.AngleSafeDeg(m_sphereCastsAxisDirectionPose)) > m_maxGroundedAngleDegrees)
+                // With the single time to impact sweep, only hits within the grounded offset count as ground hits
+                const bool withinGroundedOffset = !m_groundCloseTimeToImpact || hit.m_distance <= m_groundedSphereCastOffset;
+
+                if(ExceedsMaxGroundedAngle(hit.m_normal))
                 {
-                    steepNormals.push_back(hit);
+                    if(withinGroundedOffset)
+                        steepNormals.push_back(hit);
                     //AZ_Printf("", "Steep Angle EntityId = %s", hit.m_entityId.ToString().c_str());
                     //AZ_Printf("", "Steep Angle = %.10f", hit.m_normal.AngleSafeDeg(AZ::Vector3::CreateAxisZ()));
                     return true;
                 }
 
-                if(groundedOtherwiseGroundClose)
+                if(groundedOtherwiseGroundClose && withinGroundedOffset)
                     m_groundHits.push_back(hit);
                 else
                     m_groundCloseHits.push_back(hit);
@@ -1752,24 +2544,28 @@ namespace FirstPersonController
                 return false;
             };
 
-        m_groundHits.clear();
-        AZStd::erase_if(hits.m_hits, selfChildSlopeEntityCheck);
-        m_grounded = hits ? true : false;
+        if(runQueries)
+        {
+            m_groundHits.clear();
+            m_groundCloseHits.clear();
+            AZStd::erase_if(hits.m_hits, selfChildSlopeEntityCheck);
+        }
+        m_hot.m_grounded = !m_groundHits.empty();
 
         bool normalsSumNotSteep = false;
 
         // Check to see if the sum of the steep angles is less than or equal to m_maxGroundedAngleDegrees
-        if(!m_grounded && steepNormals.size() > 1)
+        if(!m_hot.m_grounded && steepNormals.size() > 1)
         {
             AZ::Vector3 sumNormals = AZ::Vector3::CreateZero();
-            for(AzPhysics::SceneQueryHit normal: steepNormals)
+            for(const AzPhysics::SceneQueryHit& normal: steepNormals)
                 sumNormals += normal.m_normal;
 
             //AZ_Printf("", "Sum of Steep Angles = %.10f", sumNormals.AngleSafeDeg(m_sphereCastsAxisDirectionPose));
-            if(abs(sumNormals.AngleSafeDeg(m_sphereCastsAxisDirectionPose)) <= m_maxGroundedAngleDegrees)
+            if(!ExceedsMaxGroundedAngle(sumNormals))
             {
                 normalsSumNotSteep = true;
-                m_grounded = true;
+                m_hot.m_grounded = true;
             }
         }
 
@@ -1779,71 +2575,164 @@ namespace FirstPersonController
 
         steepNormals.clear();
 
-        if(m_scriptSetGroundTick)
+        if(m_hot.m_scriptSetGroundTick)
         {
-            m_grounded = m_scriptGrounded;
-            m_scriptSetGroundTick = false;
+            m_hot.m_grounded = m_hot.m_scriptGrounded;
+            m_hot.m_scriptSetGroundTick = false;
         }
 
-        if(m_grounded)
-            m_airTime = 0.f;
+        // A grounded character's air time is this step's time
+        if(m_hot.m_grounded)
+            m_hot.m_airborneSince = m_hot.m_timerClock - deltaTime;
 
         // Check to see if the character is close to an acceptable ground
-        m_airTime += deltaTime;
 
-        request = AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
-            (1.f + m_groundSphereCastsRadiusPercentageIncrease/100.f)*m_capsuleRadius,
-            sphereCastPose,
-            sphereCastDirection,
-            m_groundCloseSphereCastOffset,
-            AzPhysics::SceneQuery::QueryType::StaticAndDynamic,
-            m_groundedCollisionGroup,
-            nullptr);
+        if(m_groundCloseTimeToImpact)
+        {
+            // Predict the time to land on the nearest acceptable ground that was hit beyond the grounded offset
+            if(runQueries)
+            {
+                m_hot.m_timeToGroundImpact = -1.f;
+                if(m_hot.m_grounded)
+                    m_hot.m_timeToGroundImpact = 0.f;
+                else if(!m_groundCloseHits.empty())
+                {
+                    float nearestDistance = m_groundCloseHits.front().m_distance;
+                    for(const AzPhysics::SceneQueryHit& hit: m_groundCloseHits)
+                        nearestDistance = AZStd::min(nearestDistance, hit.m_distance);
+                    nearestDistance -= m_groundedSphereCastOffset;
+
+                    float timeToApex = 0.f;
+                    float apexHeight = 0.f;
+                    if(velocityZ > 0.f)
+                        PredictVerticalApex(velocityZ, 0.f, verticalMotionParams, timeToApex, apexHeight);
+                    if(m_movementProfile->m_gravity < 0.f && m_movementProfile->m_jumpFallingGravityFactor > 0.f)
+                        m_hot.m_timeToGroundImpact = timeToApex
+                            + PredictVerticalFallTime(nearestDistance + apexHeight, AZStd::min(velocityZ, 0.f), verticalMotionParams);
+                    else if(velocityZ < 0.f)
+                        m_hot.m_timeToGroundImpact = nearestDistance / -velocityZ;
+                }
+            }
 
-        request.m_reportMultipleHits = true;
+            m_hot.m_groundClose = m_hot.m_grounded
+                || (m_hot.m_timeToGroundImpact >= 0.f && m_hot.m_timeToGroundImpact <= m_groundCloseTimeThreshold);
+        }
+        else
+        {
+            request = AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
+                m_derived.m_groundSphereCastsRadius,
+                sphereCastPose,
+                sphereCastDirection,
+                m_groundCloseSphereCastOffset,
+                AzPhysics::SceneQuery::QueryType::StaticAndDynamic,
+                m_groundedCollisionGroup,
+                nullptr);
+
+            request.m_reportMultipleHits = true;
 
-        groundedOtherwiseGroundClose = false;
+            groundedOtherwiseGroundClose = false;
 
-        hits = sceneInterface->QueryScene(sceneHandle, &request);
-        m_groundCloseHits.clear();
-        AZStd::erase_if(hits.m_hits, selfChildSlopeEntityCheck);
-        m_groundClose = hits ? true : false;
+            if(runQueries)
+            {
+                hits = sceneInterface->QueryScene(sceneHandle, &request);
+                AZStd::erase_if(hits.m_hits, selfChildSlopeEntityCheck);
+            }
+            m_hot.m_groundClose = !m_groundCloseHits.empty();
+        }
 
-        if(m_scriptSetGroundCloseTick)
+        if(m_hot.m_scriptSetGroundCloseTick)
         {
-            m_groundClose = m_scriptGroundClose;
-            m_scriptSetGroundCloseTick = false;
+            m_hot.m_groundClose = m_hot.m_scriptGroundClose;
+            m_hot.m_scriptSetGroundCloseTick = false;
         }
-        //AZ_Printf("", "m_groundClose = %s", m_groundClose ? "true" : "false");
+        //AZ_Printf("", "m_hot.m_groundClose = %s", m_hot.m_groundClose ? "true" : "false");
 
         // Trigger an event notification if the player hits the ground, is about to hit the ground,
         // or just left the ground (via jumping or otherwise)
-        if(!prevGrounded && m_grounded)
-            FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnGroundHit);
-        else if(!prevGroundClose && m_groundClose)
-            FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnGroundSoonHit);
-        else if(prevGrounded && !m_grounded)
-            FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnUngrounded);
+        if(!prevGrounded && m_hot.m_grounded)
+        {
+            Notify(NotificationEvent::GroundHit);
+
+            // The landing payload describes the nearest ground that was hit, it's empty when grounding was set via script
+            FirstPersonControllerImpact impact;
+            if(const AzPhysics::SceneQueryHit* nearestHit = FindNearestHit(m_groundHits))
+                impact = CreateImpact(*nearestHit, m_hot.m_prevTargetVelocity);
+            else
+                impact.m_impactVelocity = m_hot.m_prevTargetVelocity;
+            impact.m_airTime = prevAirTime;
+            NotifyImpact(NotificationEvent::GroundHitWithImpact, impact);
+        }
+        else if(!prevGroundClose && m_hot.m_groundClose)
+            Notify(NotificationEvent::GroundSoonHit);
+        else if(prevGrounded && !m_hot.m_grounded)
+            Notify(NotificationEvent::Ungrounded);
     }
 
     void FirstPersonControllerComponent::UpdateJumpMaxHoldTime()
     {
-        // Calculate the amount of time that the jump key can be held based on m_jumpHoldDistance
+        // Calculate the amount of time that the jump key can be held based on m_movementProfile->m_jumpHoldDistance
         // divided by the average of the initial jump velocity and the velocity at the edge of the capsule
-        const float jumpVelocityCapsuleEdgeSquared = m_jumpInitialVelocity*m_jumpInitialVelocity
-                                                         + 2.f*m_gravity*m_jumpHeldGravityFactor*m_jumpHoldDistance;
+        const float jumpVelocityCapsuleEdgeSquared = m_movementProfile->m_jumpInitialVelocity*m_movementProfile->m_jumpInitialVelocity
+                                                         + 2.f*m_movementProfile->m_gravity*m_movementProfile->m_jumpHeldGravityFactor*m_movementProfile->m_jumpHoldDistance;
         // If the initial velocity is large enough such that the apogee can be reached outside of the capsule
         // then compute how long the jump key is held while still inside the jump hold offset intersection capsule
         if(jumpVelocityCapsuleEdgeSquared >= 0.f)
-            m_jumpMaxHoldTime = m_jumpHoldDistance / ((m_jumpInitialVelocity
+            m_jumpMaxHoldTime = m_movementProfile->m_jumpHoldDistance / ((m_movementProfile->m_jumpInitialVelocity
                                                         + sqrt(jumpVelocityCapsuleEdgeSquared)) / 2.f);
-        // Otherwise the apogee will be reached inside m_jumpHoldDistance
+        // Otherwise the apogee will be reached inside m_movementProfile->m_jumpHoldDistance
         // and the jump time needs to computed accordingly
         else
         {
             AZ_Warning("First Person Controller Component", false, "Jump Hold Distance is higher than the max apogee of the jump.")
-            m_jumpMaxHoldTime = abs(m_jumpInitialVelocity / (m_gravity*m_jumpHeldGravityFactor));
+            m_jumpMaxHoldTime = abs(m_movementProfile->m_jumpInitialVelocity / (m_movementProfile->m_gravity*m_movementProfile->m_jumpHeldGravityFactor));
+        }
+    }
+
+    void FirstPersonControllerComponent::UpdateDerivedConstants()
+    {
+        // Greatest direction scale by magnitude, used to normalize the deceleration factor
+        m_derived.m_greatestScale = m_movementProfile->m_forwardScale;
+        for(const float scale: {m_movementProfile->m_forwardScale, m_movementProfile->m_backScale, m_movementProfile->m_leftScale, m_movementProfile->m_rightScale})
+            if(m_derived.m_greatestScale < abs(scale))
+                m_derived.m_greatestScale = abs(scale);
+        m_derived.m_greatestWalkSpeed = m_movementProfile->m_topWalkSpeed * m_derived.m_greatestScale;
+        m_derived.m_greatestCrouchSpeed = m_movementProfile->m_topWalkSpeed * m_movementProfile->m_crouchScale * m_derived.m_greatestScale;
+
+        // Greatest sprint scale by magnitude, keeping its sign. One variant falls back to 1 and the other to 0
+        // when no sprint scale has a greater magnitude.
+        m_derived.m_greatestSprintScale = 1.f;
+        m_derived.m_greatestSprintScaleOrZero = 0.f;
+        for(const float scale: {m_movementProfile->m_sprintScaleForward, m_movementProfile->m_sprintScaleBack, m_movementProfile->m_sprintScaleLeft, m_movementProfile->m_sprintScaleRight})
+        {
+            if(abs(scale) > abs(m_derived.m_greatestSprintScale))
+                m_derived.m_greatestSprintScale = scale;
+            if(abs(scale) > abs(m_derived.m_greatestSprintScaleOrZero))
+                m_derived.m_greatestSprintScaleOrZero = scale;
         }
+        m_derived.m_sprintDirectionScales[0] = m_movementProfile->m_sprintScaleForward*m_movementProfile->m_forwardScale;
+        m_derived.m_sprintDirectionScales[1] = m_movementProfile->m_sprintScaleBack*m_movementProfile->m_backScale;
+        m_derived.m_sprintDirectionScales[2] = m_movementProfile->m_sprintScaleLeft*m_movementProfile->m_leftScale;
+        m_derived.m_sprintDirectionScales[3] = m_movementProfile->m_sprintScaleRight*m_movementProfile->m_rightScale;
+
+        // The crouch distance cannot exceed the capsule's cylindrical section
+        m_derived.m_crouchDistance = AZ::GetMin(m_movementProfile->m_crouchDistance, m_capsuleHeight - 2.f*m_capsuleRadius);
+
+        m_derived.m_groundSphereCastsRadius = (1.f + m_groundSphereCastsRadiusPercentageIncrease/100.f)*m_capsuleRadius;
+
+        m_derived.m_cosMaxGroundedAngle = cos(AZ::DegToRad(m_maxGroundedAngleDegrees));
+        m_derived.m_sphereCastsAxisLength = m_sphereCastsAxisDirectionPose.GetLength();
+
+        UpdateJumpMaxHoldTime();
+    }
+
+    bool FirstPersonControllerComponent::ExceedsMaxGroundedAngle(const AZ::Vector3& normal) const
+    {
+        // The angle is greater than the max grounded angle exactly when its cosine is less than the cached cosine,
+        // which avoids the inverse cosine that computing the angle itself requires
+        const float lengthProduct = normal.GetLength() * m_derived.m_sphereCastsAxisLength;
+        if(lengthProduct == 0.f)
+            return false;
+        return normal.Dot(m_sphereCastsAxisDirectionPose) < m_derived.m_cosMaxGroundedAngle * lengthProduct;
     }
 
     void FirstPersonControllerComponent::UpdateVelocityZ(const float& deltaTime)
@@ -1855,7 +2744,7 @@ namespace FirstPersonController
         AZ::Transform sphereCastPose = AZ::Transform::CreateIdentity();
 
         // Move the sphere to the location of the character and apply the Z offset
-        sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Vector3::CreateAxisZ(m_capsuleCurrentHeight - m_capsuleRadius));
+        sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Vector3::CreateAxisZ(m_hot.m_capsuleCurrentHeight - m_capsuleRadius));
 
         AZ::Vector3 sphereCastDirection = AZ::Vector3::CreateAxisZ();
 
@@ -1864,9 +2753,9 @@ namespace FirstPersonController
         {
             sphereCastDirection = m_sphereCastsAxisDirectionPose;
             if(m_sphereCastsAxisDirectionPose.GetZ() >= 0.f)
-                sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(), m_sphereCastsAxisDirectionPose).TransformVector(AZ::Vector3::CreateAxisZ(m_capsuleCurrentHeight - m_capsuleRadius)));
+                sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(), m_sphereCastsAxisDirectionPose).TransformVector(AZ::Vector3::CreateAxisZ(m_hot.m_capsuleCurrentHeight - m_capsuleRadius)));
             else
-                sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(-1.f), m_sphereCastsAxisDirectionPose).TransformVector(-AZ::Vector3::CreateAxisZ(m_capsuleCurrentHeight - m_capsuleRadius)));
+                sphereCastPose.SetTranslation(GetEntity()->GetTransform()->GetWorldTM().GetTranslation() + AZ::Quaternion::CreateShortestArc(AZ::Vector3::CreateAxisZ(-1.f), m_sphereCastsAxisDirectionPose).TransformVector(-AZ::Vector3::CreateAxisZ(m_hot.m_capsuleCurrentHeight - m_capsuleRadius)));
         }
 
         AzPhysics::ShapeCastRequest request = AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
@@ -1880,8 +2769,14 @@ namespace FirstPersonController
 
         request.m_reportMultipleHits = true;
 
+        // Otherwise the result of the query made earlier on this frame is reused
+        const bool runQuery = !m_headQueryOncePerFrame || m_headQueryFrame != m_frameCounter;
+        m_headQueryFrame = m_frameCounter;
+
         AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
-        AzPhysics::SceneQueryHits hits = sceneInterface->QueryScene(sceneHandle, &request);
+        AzPhysics::SceneQueryHits hits;
+        if(runQuery)
+            hits = sceneInterface->QueryScene(sceneHandle, &request);
 
         // Disregard intersections with the character's collider and its child entities,
         auto selfChildEntityCheck = [this](AzPhysics::SceneQueryHit& hit)
@@ -1918,123 +2813,167 @@ namespace FirstPersonController
                 return false;
             };
 
-        AZStd::erase_if(hits.m_hits, selfChildEntityCheck);
-
-        m_headHit = hits ? true : false;
+        if(runQuery)
+        {
+            AZStd::erase_if(hits.m_hits, selfChildEntityCheck);
 
-        m_headHitEntityIds.clear();
-        if(m_headHit)
-            for(AzPhysics::SceneQueryHit hit: hits.m_hits)
+            m_headHitEntityIds.clear();
+            for(const AzPhysics::SceneQueryHit& hit: hits.m_hits)
                 m_headHitEntityIds.push_back(hit.m_entityId);
 
-        if(m_headHit && !m_grounded && m_applyVelocityZ >= 0.f)
-            FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnHeadHit);
+            m_headImpact = FirstPersonControllerImpact();
+            if(const AzPhysics::SceneQueryHit* nearestHit = FindNearestHit(hits.m_hits))
+                m_headImpact = CreateImpact(*nearestHit, m_hot.m_prevTargetVelocity);
+        }
+
+        m_hot.m_headHit = !m_headHitEntityIds.empty();
+
+        if(m_hot.m_headHit && !m_hot.m_grounded && m_hot.m_applyVelocityZ >= 0.f)
+        {
+            Notify(NotificationEvent::HeadHit);
+            NotifyImpact(NotificationEvent::HeadHitWithImpact, m_headImpact);
+        }
 
-        if(m_gravityPrevented[0] && m_gravityPrevented[1])
+        if(m_hot.m_gravityPreventedFirstTick && m_hot.m_gravityPrevented)
         {
-            m_applyVelocityZ = m_correctedVelocityZ;
-            m_gravityPrevented[0] = false;
-            m_gravityPrevented[1] = false;
-            m_grounded = true;
-            m_groundClose = true;
+            m_hot.m_applyVelocityZ = m_hot.m_correctedVelocityZ;
+            m_hot.m_gravityPreventedFirstTick = false;
+            m_hot.m_gravityPrevented = false;
+            m_hot.m_grounded = true;
+            m_hot.m_groundClose = true;
             if(m_jumpAllowedWhenGravityPrevented)
-                m_jumpHeld = false;
+                m_hot.m_jumpHeld = false;
         }
 
-        const float prevApplyVelocityZ = m_applyVelocityZ;
+        const float prevApplyVelocityZ = m_hot.m_applyVelocityZ;
+
+        // With exact integration the applied Z velocity is the average over the last step and the current delta holds
+        // the difference to the velocity at the end of that step, so the state machine below works with the latter
+        if(m_exactVelocityZ)
+        {
+            m_hot.m_applyVelocityZ += m_hot.m_applyVelocityZCurrentDelta;
+            m_hot.m_applyVelocityZCurrentDelta = 0.f;
+        }
+        bool integrateExact = false;
+        float exactHoldTime = 0.f;
 
         bool initialJump = false;
 
-        if(m_grounded && (m_jumpReqRepress || m_applyVelocityZ <= 0.f))
+        if(m_hot.m_grounded && (m_hot.m_jumpReqRepress || m_hot.m_applyVelocityZ <= 0.f))
         {
-            if(m_jumpValue && !m_jumpHeld && !m_headHit)
+            if(m_jumpValue && !m_hot.m_jumpHeld && !m_hot.m_headHit)
             {
-                if(!m_standing)
+                if(!m_hot.m_standing)
                 {
                     if(m_crouchJumpCausesStanding)
-                        m_crouching = false;
+                        m_hot.m_crouching = false;
                     return;
                 }
-                m_applyVelocityZCurrentDelta = m_jumpInitialVelocity;
+                m_hot.m_applyVelocityZCurrentDelta = m_movementProfile->m_jumpInitialVelocity;
                 initialJump = true;
-                m_jumpHeld = true;
-                m_jumpReqRepress = false;
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnFirstJump);
+                m_hot.m_jumpHeld = true;
+                m_hot.m_jumpReqRepress = false;
+                if(m_exactVelocityZ)
+                {
+                    m_hot.m_applyVelocityZ = m_movementProfile->m_jumpInitialVelocity;
+                    m_hot.m_applyVelocityZCurrentDelta = 0.f;
+                    exactHoldTime = AZStd::min(deltaTime, m_jumpMaxHoldTime);
+                    m_hot.m_jumpCounter = exactHoldTime;
+                    integrateExact = true;
+                }
+                Notify(NotificationEvent::FirstJump);
             }
             else
             {
-                m_applyVelocityZ = 0.f;
-                m_applyVelocityZCurrentDelta = 0.f;
-                m_jumpCounter = 0.f;
+                m_hot.m_applyVelocityZ = 0.f;
+                m_hot.m_applyVelocityZCurrentDelta = 0.f;
+                m_hot.m_jumpCounter = 0.f;
 
-                if(m_jumpValue == 0.f && m_jumpHeld)
-                    m_jumpHeld = false;
+                if(m_jumpValue == 0.f && m_hot.m_jumpHeld)
+                    m_hot.m_jumpHeld = false;
 
-                if(m_doubleJumpEnabled && m_secondJump)
-                    m_secondJump = false;
+                if(m_doubleJumpEnabled && m_hot.m_secondJump)
+                    m_hot.m_secondJump = false;
             }
         }
-        else if((m_jumpCounter + deltaTime/2.f) < m_jumpMaxHoldTime && m_applyVelocityZ > 0.f && m_jumpHeld && !m_jumpReqRepress)
+        else if((m_hot.m_jumpCounter + (m_exactVelocityZ ? 0.f : deltaTime/2.f)) < m_jumpMaxHoldTime && m_hot.m_applyVelocityZ > 0.f && m_hot.m_jumpHeld && !m_hot.m_jumpReqRepress)
         {
+            integrateExact = true;
             if(m_jumpValue == 0.f)
             {
-                m_jumpHeld = false;
-                m_jumpCounter = 0.f;
-                m_applyVelocityZCurrentDelta = m_gravity * deltaTime;
+                m_hot.m_jumpHeld = false;
+                m_hot.m_jumpCounter = 0.f;
+                m_hot.m_applyVelocityZCurrentDelta = m_movementProfile->m_gravity * deltaTime;
             }
             else
             {
-                m_jumpCounter += deltaTime;
-                m_applyVelocityZCurrentDelta = m_gravity * m_jumpHeldGravityFactor * deltaTime;
+                exactHoldTime = AZStd::min(deltaTime, m_jumpMaxHoldTime - m_hot.m_jumpCounter);
+                m_hot.m_jumpCounter += deltaTime;
+                m_hot.m_applyVelocityZCurrentDelta = m_movementProfile->m_gravity * m_movementProfile->m_jumpHeldGravityFactor * deltaTime;
             }
         }
         else
         {
-            if(!m_jumpReqRepress)
-                m_jumpReqRepress = true;
+            integrateExact = true;
 
-            if(m_jumpCounter != 0.f)
-                m_jumpCounter = 0.f;
+            if(!m_hot.m_jumpReqRepress)
+                m_hot.m_jumpReqRepress = true;
 
-            if(m_applyVelocityZ <= 0.f)
-                m_applyVelocityZCurrentDelta = m_gravity * m_jumpFallingGravityFactor * deltaTime;
+            if(m_hot.m_jumpCounter != 0.f)
+                m_hot.m_jumpCounter = 0.f;
+
+            if(m_hot.m_applyVelocityZ <= 0.f)
+                m_hot.m_applyVelocityZCurrentDelta = m_movementProfile->m_gravity * m_movementProfile->m_jumpFallingGravityFactor * deltaTime;
             else
-                m_applyVelocityZCurrentDelta = m_gravity * deltaTime;
+                m_hot.m_applyVelocityZCurrentDelta = m_movementProfile->m_gravity * deltaTime;
 
-            if(m_jumpHeld && m_jumpValue == 0.f)
-                m_jumpHeld = false;
+            if(m_hot.m_jumpHeld && m_jumpValue == 0.f)
+                m_hot.m_jumpHeld = false;
 
-            if(m_doubleJumpEnabled && !m_secondJump && !m_jumpHeld && m_jumpValue != 0.f)
+            if(m_doubleJumpEnabled && !m_hot.m_secondJump && !m_hot.m_jumpHeld && m_jumpValue != 0.f)
             {
-                if(!m_standing)
+                if(!m_hot.m_standing)
                 {
                     if(m_crouchJumpCausesStanding)
-                        m_crouching = false;
+                        m_hot.m_crouching = false;
                     return;
                 }
-                m_applyVelocityZ = m_jumpSecondInitialVelocity;
-                m_applyVelocityZCurrentDelta = 0.f;
-                m_secondJump = true;
-                m_jumpHeld = true;
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnSecondJump);
+                m_hot.m_applyVelocityZ = m_movementProfile->m_jumpSecondInitialVelocity;
+                m_hot.m_applyVelocityZCurrentDelta = 0.f;
+                m_hot.m_secondJump = true;
+                m_hot.m_jumpHeld = true;
+                Notify(NotificationEvent::SecondJump);
             }
         }
 
+        if(m_exactVelocityZ)
+        {
+            // Apply the average velocity over the step and carry the difference to the velocity at the end of the step
+            if(integrateExact && deltaTime > 0.f)
+            {
+                float endVelocityZ = m_hot.m_applyVelocityZ;
+                const float displacementZ = IntegrateVerticalMotion(endVelocityZ, exactHoldTime, deltaTime,
+                    VerticalMotionParams{m_movementProfile->m_gravity, m_movementProfile->m_jumpHeldGravityFactor, m_movementProfile->m_jumpFallingGravityFactor});
+                m_hot.m_applyVelocityZ = displacementZ / deltaTime;
+                m_hot.m_applyVelocityZCurrentDelta = endVelocityZ - m_hot.m_applyVelocityZ;
+            }
+            m_hot.m_applyVelocityZPrevDelta = 0.f;
+        }
         // Perform an average of the current and previous Z velocity delta
         // as described by Verlet integration, which should reduce accumulated error
-        if(!initialJump)
+        else if(!initialJump)
         {
-            m_applyVelocityZ += (m_applyVelocityZCurrentDelta + m_applyVelocityZPrevDelta) / 2.f;
-            m_applyVelocityZPrevDelta = m_applyVelocityZCurrentDelta;
+            m_hot.m_applyVelocityZ += (m_hot.m_applyVelocityZCurrentDelta + m_hot.m_applyVelocityZPrevDelta) / 2.f;
+            m_hot.m_applyVelocityZPrevDelta = m_hot.m_applyVelocityZCurrentDelta;
         }
         else
-            m_applyVelocityZ += m_applyVelocityZCurrentDelta;
+            m_hot.m_applyVelocityZ += m_hot.m_applyVelocityZCurrentDelta;
 
-        if(m_headHit && m_applyVelocityZ > 0.f && m_headHitSetsApogee)
-            m_applyVelocityZ = m_applyVelocityZCurrentDelta = 0.f;
+        if(m_hot.m_headHit && m_hot.m_applyVelocityZ > 0.f && m_headHitSetsApogee)
+            m_hot.m_applyVelocityZ = m_hot.m_applyVelocityZCurrentDelta = 0.f;
 
         // Account for the case where the PhysX Character Gameplay component's gravity is used instead
-        if(m_gravity == 0.f && m_grounded)
+        if(m_movementProfile->m_gravity == 0.f && m_hot.m_grounded)
         {
             AZ::Vector3 currentVelocity = AZ::Vector3::CreateZero();
             Physics::CharacterRequestBus::EventResult(currentVelocity, GetEntityId(),
@@ -2050,27 +2989,27 @@ namespace FirstPersonController
             }
 
             if(currentVelocity.GetZ() < 0.f)
-                m_applyVelocityZ = m_applyVelocityZCurrentDelta = 0.f;
+                m_hot.m_applyVelocityZ = m_hot.m_applyVelocityZCurrentDelta = 0.f;
         }
 
-        if(prevApplyVelocityZ == 0.f && m_applyVelocityZ < 0.f)
-            FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnStartedFalling);
-        if(prevApplyVelocityZ > 0.f && m_applyVelocityZ <= 0.f)
-            FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnJumpApogeeReached);
+        if(prevApplyVelocityZ == 0.f && m_hot.m_applyVelocityZ < 0.f)
+            Notify(NotificationEvent::StartedFalling);
+        if(prevApplyVelocityZ > 0.f && m_hot.m_applyVelocityZ <= 0.f)
+            Notify(NotificationEvent::JumpApogeeReached);
 
         // Debug print statements to observe the jump mechanic
         //AZ::Vector3 pos = GetEntity()->GetTransform()->GetWorldTM().GetTranslation();
         //AZ_Printf("", "Z Position = %.10f", pos.GetZ());
         //AZ_Printf("", "currentVelocity.GetZ() = %.10f", currentVelocity.GetZ());
-        //AZ_Printf("", "m_applyVelocityZPrevDelta = %.10f", m_applyVelocityZPrevDelta);
-        //AZ_Printf("", "m_applyVelocityZCurrentDelta = %.10f", m_applyVelocityZCurrentDelta);
-        //AZ_Printf("", "m_applyVelocityZ = %.10f", m_applyVelocityZ);
-        //AZ_Printf("", "m_grounded = %s", m_grounded ? "true" : "false");
-        //AZ_Printf("", "m_jumpCounter = %.10f", m_jumpCounter);
+        //AZ_Printf("", "m_hot.m_applyVelocityZPrevDelta = %.10f", m_hot.m_applyVelocityZPrevDelta);
+        //AZ_Printf("", "m_hot.m_applyVelocityZCurrentDelta = %.10f", m_hot.m_applyVelocityZCurrentDelta);
+        //AZ_Printf("", "m_hot.m_applyVelocityZ = %.10f", m_hot.m_applyVelocityZ);
+        //AZ_Printf("", "m_hot.m_grounded = %s", m_hot.m_grounded ? "true" : "false");
+        //AZ_Printf("", "m_hot.m_jumpCounter = %.10f", m_hot.m_jumpCounter);
         //AZ_Printf("", "deltaTime = %.10f", deltaTime);
         //AZ_Printf("", "m_jumpMaxHoldTime = %.10f", m_jumpMaxHoldTime);
-        //AZ_Printf("", "m_jumpHoldDistance = %.10f", m_jumpHoldDistance);
-        //AZ_Printf("", "dvz/dt = %.10f", (m_applyVelocityZ - prevApplyVelocityZ)/deltaTime);
+        //AZ_Printf("", "m_movementProfile->m_jumpHoldDistance = %.10f", m_movementProfile->m_jumpHoldDistance);
+        //AZ_Printf("", "dvz/dt = %.10f", (m_hot.m_applyVelocityZ - prevApplyVelocityZ)/deltaTime);
         //AZ_Printf("","");
     }
 
@@ -2142,196 +3081,561 @@ namespace FirstPersonController
     }
 
     void FirstPersonControllerComponent::ProcessInput(const float& deltaTime, const bool& timestepElseTick)
+    {
+        if(m_pooled)
+            return;
+
+        const FirstPersonControllerComponent* outerSteppingController = s_steppingController;
+        s_steppingController = this;
+        ConsumeInputCommands();
+        ApplyQueuedSetters();
+
+        // A sleeping character only checks whether it has been disturbed, once per tick, or whether a timer reaches its next event
+        // on this step. The timer clock is otherwise advanced by the steps themselves, so it only advances here while asleep.
+        if(m_sleeping.load(AZStd::memory_order_relaxed))
+        {
+            const double clockAfterStep = (!m_addVelocityForTimestepVsTick || timestepElseTick) ? m_hot.m_timerClock + deltaTime : m_hot.m_timerClock;
+            if(!timestepElseTick && CheckSleepDisturbed())
+                WakeUp();
+            else if(clockAfterStep >= GetNextTimerEventTime())
+                WakeUp();
+
+            if(m_sleeping.load(AZStd::memory_order_relaxed))
+            {
+                // A grounded character's air time is its last step's time, so it's kept there while the clock runs without a step
+                if(m_hot.m_grounded)
+                    m_hot.m_airborneSince += clockAfterStep - m_hot.m_timerClock;
+                m_hot.m_timerClock = clockAfterStep;
+                s_steppingController = outerSteppingController;
+                return;
+            }
+        }
+
+        // Steps skipped by the update tier keep applying the last velocity, and their time is given to the next step that runs,
+        // including the first step after a change to the full rate
+        const AZ::u32 branch = timestepElseTick ? 1 : 0;
+        m_updateTierSkippedTime[branch] += deltaTime;
+        if(m_updateTier != 0)
+        {
+            const AZ::u32 interval = (m_updateTier == 1) ? 2 : 4;
+            if((m_updateTierStepCounter[branch]++ + m_updateTierPhase) % interval != 0)
+            {
+                if(!m_addVelocityForTimestepVsTick || timestepElseTick)
+                    SubmitVelocity(m_hot.m_prevTargetVelocity);
+                s_steppingController = outerSteppingController;
+                return;
+            }
+        }
+        const float stepDeltaTime = m_updateTierSkippedTime[branch];
+        m_updateTierSkippedTime[branch] = 0.f;
+
+        if(m_updateTier >= 3)
+            GroundSnapStep(stepDeltaTime, timestepElseTick);
+        else
+            ProcessStep(stepDeltaTime, timestepElseTick);
+
+        if(m_sleepWhenIdle && !timestepElseTick)
+            UpdateSleep(stepDeltaTime);
+
+        UpdateStateSnapshot();
+        m_notificationStepCount.fetch_add(1, AZStd::memory_order_release);
+        s_steppingController = outerSteppingController;
+    }
+
+    // The full per-step update, run on each step that the update tier doesn't skip
+    void FirstPersonControllerComponent::ProcessStep(const float& deltaTime, const bool& timestepElseTick)
     {
         // Only update the rotation on each tick
         if(!timestepElseTick)
         {
+            if(!m_moveCommands.empty() || !m_faceCommands.empty() || !m_actionCommands.empty())
+                RunMovementCommands(deltaTime);
+
             UpdateRotation(deltaTime);
 
+            if(m_crowdSeparation)
+                UpdateSeparation();
+
             // Get the current velocity to determine if something was hit
             AZ::Vector3 currentVelocity = AZ::Vector3::CreateZero();
             Physics::CharacterRequestBus::EventResult(currentVelocity, GetEntityId(),
                 &Physics::CharacterRequestBus::Events::GetVelocity);
 
-            if(!m_prevPrevTargetVelocity.IsClose(currentVelocity, m_velocityCloseTolerance))
+            if(!m_hot.m_prevPrevTargetVelocity.IsClose(currentVelocity, m_velocityCloseTolerance))
             {
                 // If enabled, cause the character's applied velocity to match the current velocity from Physics
-                m_hitSomething = true;
+                m_hot.m_hitSomething = true;
 
                 if(m_velocityXCrossYDirection == AZ::Vector3::CreateAxisZ())
-                    m_correctedVelocityXY = AZ::Vector2(currentVelocity);
+                    m_hot.m_correctedVelocityXY = AZ::Vector2(currentVelocity);
                 else
-                    m_correctedVelocityXY = AZ::Vector2(currentVelocity.Dot(TiltVectorXCrossY(AZ::Vector2::CreateAxisX(), m_velocityXCrossYDirection)), currentVelocity.Dot(TiltVectorXCrossY(AZ::Vector2::CreateAxisY(), m_velocityXCrossYDirection)));
+                    m_hot.m_correctedVelocityXY = AZ::Vector2(currentVelocity.Dot(TiltVectorXCrossY(AZ::Vector2::CreateAxisX(), m_velocityXCrossYDirection)), currentVelocity.Dot(TiltVectorXCrossY(AZ::Vector2::CreateAxisY(), m_velocityXCrossYDirection)));
 
                 if(m_velocityZPosDirection == AZ::Vector3::CreateAxisZ())
-                    m_correctedVelocityZ = currentVelocity.GetZ();
+                    m_hot.m_correctedVelocityZ = currentVelocity.GetZ();
                 else
-                    m_correctedVelocityZ = currentVelocity.Dot(m_velocityZPosDirection);
+                    m_hot.m_correctedVelocityZ = currentVelocity.Dot(m_velocityZPosDirection);
 
-                if(!m_gravityIgnoresObstacles && !m_prevTargetVelocity.IsClose(currentVelocity, m_velocityCloseTolerance) && m_prevTargetVelocity.Dot(m_velocityZPosDirection) < 0.f && AZ::IsClose(currentVelocity.Dot(m_velocityZPosDirection), 0.f))
+                if(!m_gravityIgnoresObstacles && !m_hot.m_prevTargetVelocity.IsClose(currentVelocity, m_velocityCloseTolerance) && m_hot.m_prevTargetVelocity.Dot(m_velocityZPosDirection) < 0.f && AZ::IsClose(currentVelocity.Dot(m_velocityZPosDirection), 0.f))
                 {
                     // Gravity needs to be prevented for two ticks in a row to prevent exploitable behavior
-                    if(m_gravityPrevented[0])
+                    if(m_hot.m_gravityPreventedFirstTick)
                     {
-                        m_gravityPrevented[1] = true;
-                        FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnGravityPrevented);
+                        m_hot.m_gravityPrevented = true;
+                        Notify(NotificationEvent::GravityPrevented);
                     }
                     else
-                        m_gravityPrevented[0] = true;
+                        m_hot.m_gravityPreventedFirstTick = true;
                 }
                 else
-                    m_gravityPrevented[0] = m_gravityPrevented[1] = false;
+                    m_hot.m_gravityPreventedFirstTick = m_hot.m_gravityPrevented = false;
+
+                Notify(NotificationEvent::HitSomething);
 
-                FirstPersonControllerNotificationBus::Broadcast(&FirstPersonControllerNotificationBus::Events::OnHitSomething);
+                // No scene query identifies what was hit, so the normal is estimated from the change in velocity
+                FirstPersonControllerImpact impact;
+                impact.m_impactVelocity = m_hot.m_prevPrevTargetVelocity;
+                impact.m_normal = (currentVelocity - m_hot.m_prevPrevTargetVelocity).GetNormalizedSafe();
+                AZ::TransformBus::EventResult(impact.m_position, GetEntityId(), &AZ::TransformBus::Events::GetWorldTranslation);
+                NotifyImpact(NotificationEvent::HitSomethingWithImpact, impact);
             }
             else
-                m_hitSomething = false;
+                m_hot.m_hitSomething = false;
         }
 
-        m_prevPrevTargetVelocity = m_prevTargetVelocity;
-
         if(!m_addVelocityForTimestepVsTick || timestepElseTick)
         {
-            CheckGrounded(deltaTime);
-
-            if(m_grounded)
-                CrouchManager(deltaTime);
-
-            // So long as the character is grounded or depending on how the update X&Y velocity while jumping
-            // boolean values are set, and based on the state of jumping/falling, update the X&Y velocity accordingly
-            if(m_grounded || (m_updateXYAscending && m_updateXYDescending && !m_updateXYOnlyNearGround)
-               || ((m_updateXYAscending && m_applyVelocityZ >= 0.f) && (!m_updateXYOnlyNearGround || m_groundClose))
-               || ((m_updateXYDescending && m_applyVelocityZ <= 0.f) && (!m_updateXYOnlyNearGround || m_groundClose)) )
-                UpdateVelocityXY(deltaTime);
-
-            UpdateVelocityZ(deltaTime);
-
-            // Track the sum of the normal vectors for the velocity's XY plane if its set
-            if(m_velocityXCrossYTracksNormal)
-                SetVelocityXCrossYDirection(GetGroundSumNormalsDirection());
-
-            AZ::Vector3 addVelocityHeading = m_addVelocityHeading;
-            // Rotate addVelocityHeading so it's with respect to the character's heading
-            if(!addVelocityHeading.IsZero())
-                addVelocityHeading = AZ::Quaternion::CreateRotationZ(m_currentHeading).TransformVector(m_addVelocityHeading);
-            // Tilt the XY velocity plane based on m_velocityXCrossYDirection
-            m_prevTargetVelocity = TiltVectorXCrossY((m_applyVelocityXY + AZ::Vector2(m_addVelocityWorld) + AZ::Vector2(addVelocityHeading)), m_velocityXCrossYDirection);
-            // Change the +Z direction based on m_velocityZPosDirection
-            m_prevTargetVelocity += (m_applyVelocityZ + m_addVelocityWorld.GetZ() + m_addVelocityHeading.GetZ()) * m_velocityZPosDirection;
-
-            // Placed here for when CharacterControllerComponent::SetUpDirection() is implemented
-            /* Physics::CharacterRequestBus::Event(GetEntityId(),
-                  &Physics::CharacterRequestBus::Events::SetUpDirection, m_sphereCastsAxisDirectionPose); */
-
-            if(!m_addVelocityForTimestepVsTick)
-                Physics::CharacterRequestBus::Event(GetEntityId(),
-                    &Physics::CharacterRequestBus::Events::AddVelocityForTick,
-                    m_prevTargetVelocity);
+            if(!timestepElseTick && m_fixedStepTick)
+                FixedStepTick(deltaTime);
             else
-                Physics::CharacterRequestBus::Event(GetEntityId(),
-                    &Physics::CharacterRequestBus::Events::AddVelocityForPhysicsTimestep,
-                    m_prevTargetVelocity);
+            {
+                m_hot.m_prevPrevTargetVelocity = m_hot.m_prevTargetVelocity;
+                SimulateStep(deltaTime);
+                SubmitVelocity(m_hot.m_prevTargetVelocity);
+            }
         }
+        else
+            m_hot.m_prevPrevTargetVelocity = m_hot.m_prevTargetVelocity;
     }
 
-    // Event Notification methods for use in scripts
-    void FirstPersonControllerComponent::OnGroundHit(){}
-    void FirstPersonControllerComponent::OnGroundSoonHit(){}
-    void FirstPersonControllerComponent::OnUngrounded(){}
-    void FirstPersonControllerComponent::OnStartedFalling(){}
-    void FirstPersonControllerComponent::OnJumpApogeeReached(){}
-    void FirstPersonControllerComponent::OnStartedMoving(){}
-    void FirstPersonControllerComponent::OnTargetVelocityReached(){}
-    void FirstPersonControllerComponent::OnStopped(){}
-    void FirstPersonControllerComponent::OnTopWalkSpeedReached(){}
-    void FirstPersonControllerComponent::OnTopSprintSpeedReached(){}
-    void FirstPersonControllerComponent::OnHeadHit(){}
-    void FirstPersonControllerComponent::OnHitSomething(){}
-    void FirstPersonControllerComponent::OnGravityPrevented(){}
-    void FirstPersonControllerComponent::OnCrouched(){}
-    void FirstPersonControllerComponent::OnStoodUp(){}
-    void FirstPersonControllerComponent::OnStandPrevented(){}
-    void FirstPersonControllerComponent::OnStartedCrouching(){}
-    void FirstPersonControllerComponent::OnStartedStanding(){}
-    void FirstPersonControllerComponent::OnFirstJump(){}
-    void FirstPersonControllerComponent::OnSecondJump(){}
-    void FirstPersonControllerComponent::OnStaminaCapped(){}
-    void FirstPersonControllerComponent::OnStaminaReachedZero(){}
-    void FirstPersonControllerComponent::OnSprintStarted(){}
-    void FirstPersonControllerComponent::OnCooldownStarted(){}
-    void FirstPersonControllerComponent::OnCooldownDone(){}
-
-    // Request Bus getter and setter methods for use in scripts
-    AZ::EntityId FirstPersonControllerComponent::GetActiveCameraEntityId() const
+    // Minimal update for the farthest update tier: the character stops moving horizontally and only falls until it's grounded
+    void FirstPersonControllerComponent::GroundSnapStep(const float& deltaTime, const bool& timestepElseTick)
     {
-        return m_activeCameraEntity->GetId();
+        if(m_addVelocityForTimestepVsTick && !timestepElseTick)
+            return;
+
+        m_hot.m_prevPrevTargetVelocity = m_hot.m_prevTargetVelocity;
+        m_hot.m_timerClock += deltaTime;
+        CheckGrounded(deltaTime);
+
+        m_hot.m_applyVelocityXY = AZ::Vector2::CreateZero();
+        float averageVelocityZ = 0.f;
+        if(m_hot.m_grounded)
+            m_hot.m_applyVelocityZ = 0.f;
+        else
+        {
+            float velocityZ = m_hot.m_applyVelocityZ;
+            if(m_exactVelocityZ)
+                velocityZ += m_hot.m_applyVelocityZCurrentDelta;
+            const float displacementZ = IntegrateVerticalMotion(velocityZ, 0.f, deltaTime,
+                VerticalMotionParams{m_movementProfile->m_gravity, m_movementProfile->m_jumpHeldGravityFactor, m_movementProfile->m_jumpFallingGravityFactor});
+            averageVelocityZ = (deltaTime > 0.f) ? displacementZ / deltaTime : velocityZ;
+            m_hot.m_applyVelocityZ = velocityZ;
+        }
+        m_hot.m_applyVelocityZCurrentDelta = 0.f;
+
+        m_hot.m_prevTargetVelocity = m_velocityZPosDirection * averageVelocityZ;
+        SubmitVelocity(m_hot.m_prevTargetVelocity);
     }
-    void FirstPersonControllerComponent::ReacquireChildEntityIds()
+
+    // Sum the steering away from each nearby controller, weighted by how far it is inside the separation radius.
+    // The result is added to the X&Y velocity in SimulateStep, so it's part of the target velocity that the current
+    // velocity is compared against and the steering itself isn't mistaken for having hit something.
+    void FirstPersonControllerComponent::UpdateSeparation()
     {
-        AZ::TransformBus::EventResult(m_children, GetEntityId(), &AZ::TransformBus::Events::GetChildren);
+        m_separationVelocityXY = AZ::Vector2::CreateZero();
+
+        auto* firstPersonControllerInterface = FirstPersonControllerInterface::Get();
+        if(firstPersonControllerInterface == nullptr || m_separationRadius <= 0.f || m_separationSpeed <= 0.f)
+            return;
+
+        const AZ::Vector3 position = GetEntity()->GetTransform()->GetWorldTM().GetTranslation();
+        // The neighbors' positions come from the spatial hash along with their IDs, instead of a transform lookup for each
+        AZ::EntityId neighbors[MaxSeparationNeighbors];
+        AZ::Vector3 neighborPositions[MaxSeparationNeighbors];
+        const AZ::u32 neighborCount = AZStd::min(firstPersonControllerInterface->QueryControllersInRadius(position, m_separationRadius, neighbors, neighborPositions, MaxSeparationNeighbors), MaxSeparationNeighbors);
+
+        for(AZ::u32 i = 0; i < neighborCount; ++i)
+        {
+            if(neighbors[i] == GetEntityId())
+                continue;
+
+            AZ::Vector2 away = AZ::Vector2(position - neighborPositions[i]);
+            const float distance = away.GetLength();
+            if(distance >= m_separationRadius)
+                continue;
+
+            // Characters on top of each other are split along X, in opposite directions for the two of them
+            if(distance < 0.001f)
+                away = AZ::Vector2::CreateAxisX((GetEntityId() < neighbors[i]) ? 1.f : -1.f);
+            else
+                away /= distance;
+
+            m_separationVelocityXY += away * (1.f - distance / m_separationRadius) * m_separationSpeed;
+        }
+
+        if(m_separationVelocityXY.GetLength() > m_separationSpeed)
+            m_separationVelocityXY = m_separationVelocityXY.GetNormalized() * m_separationSpeed;
     }
-    void FirstPersonControllerComponent::ReacquireCapsuleDimensions()
+
+    bool FirstPersonControllerComponent::IsIdle() const
     {
-        PhysX::CharacterControllerRequestBus::EventResult(m_capsuleHeight, GetEntityId(),
-            &PhysX::CharacterControllerRequestBus::Events::GetHeight);
-        PhysX::CharacterControllerRequestBus::EventResult(m_capsuleRadius, GetEntityId(),
-            &PhysX::CharacterControllerRequestBus::Events::GetRadius);
+        if(!m_hot.m_grounded || m_hot.m_hitSomething || m_groundHits.empty())
+            return false;
+
+        // Not moving and not settling into a crouch or a stand
+        if(!m_hot.m_prevTargetVelocity.IsZero() || !m_hot.m_applyVelocityXY.IsZero()
+            || (m_scriptSetsTargetVelocityXY && !m_scriptTargetVelocityXY.IsZero())
+            || !(m_hot.m_standing || m_hot.m_crouched))
+            return false;
 
-        if(m_crouchDistance > m_capsuleHeight - 2.f*m_capsuleRadius)
-            m_crouchDistance = m_capsuleHeight - 2.f*m_capsuleRadius;
+        // No input, including rotation that is still being smoothed out
+        if(m_forwardValue != 0.f || m_backValue != 0.f || m_leftValue != 0.f || m_rightValue != 0.f
+            || m_yawValue != 0.f || m_pitchValue != 0.f || m_crouchValue != 0.f || m_jumpValue != 0.f
+            || !m_newLookRotationDelta.IsClose(AZ::Quaternion::CreateIdentity()))
+            return false;
 
-        m_capsuleCurrentHeight = m_capsuleHeight;
+        // Stamina that is being drained, the other sprint timers are evaluated from the clock and wake the character
+        // when they reach their next event
+        if(m_hot.m_sprintDraining)
+            return false;
+
+        return m_moveCommands.empty() && m_faceCommands.empty() && m_actionCommands.empty();
     }
-    void FirstPersonControllerComponent::ReacquireMaxSlopeAngle()
+
+    void FirstPersonControllerComponent::UpdateSleep(const float& deltaTime)
     {
-        Physics::CharacterRequestBus::EventResult(m_maxGroundedAngleDegrees, GetEntityId(),
-            &Physics::CharacterRequestBus::Events::GetSlopeLimitDegrees);
+        if(!IsIdle())
+        {
+            m_sleepIdleTime = 0.f;
+            return;
+        }
 
-        // Set the max grounded angle to be slightly greater than the PhysX Character Controller's
-        // maximum slope angle value
-        m_maxGroundedAngleDegrees += 0.01f;
+        m_sleepIdleTime += deltaTime;
+        if(m_sleepIdleTime < m_sleepIdleDelay)
+            return;
+
+        // Only sleep on a static body, since anything else can move out from under the character.
+        // Static Rigid Bodies are not connected to the RigidBodyRequestBus.
+        const AzPhysics::SceneQueryHit* groundHit = &m_groundHits.front();
+        for(const AzPhysics::SceneQueryHit& hit: m_groundHits)
+            if(hit.m_distance < groundHit->m_distance)
+                groundHit = &hit;
+
+        AzPhysics::RigidBody* groundBody = nullptr;
+        Physics::RigidBodyRequestBus::EventResult(groundBody, groundHit->m_entityId, &Physics::RigidBodyRequests::GetRigidBody);
+        if(groundBody != nullptr)
+            return;
+
+        m_sleepGroundEntityId = groundHit->m_entityId;
+        m_sleepGroundPosition = AZ::Vector3::CreateZero();
+        AZ::TransformBus::EventResult(m_sleepGroundPosition, m_sleepGroundEntityId, &AZ::TransformBus::Events::GetWorldTranslation);
+        AZ::TransformBus::EventResult(m_sleepPosition, GetEntityId(), &AZ::TransformBus::Events::GetWorldTranslation);
+
+        m_sleeping.store(true, AZStd::memory_order_relaxed);
     }
-    AZStd::string FirstPersonControllerComponent::GetForwardEventName() const
+
+    // True when the character or the body it's sleeping on has been moved by something else
+    bool FirstPersonControllerComponent::CheckSleepDisturbed() const
     {
-        return m_strForward;
+        AZ::Vector3 position = m_sleepPosition;
+        AZ::TransformBus::EventResult(position, GetEntityId(), &AZ::TransformBus::Events::GetWorldTranslation);
+        if(!position.IsClose(m_sleepPosition))
+            return true;
+
+        AZ::Vector3 groundPosition = m_sleepGroundPosition;
+        AZ::TransformBus::EventResult(groundPosition, m_sleepGroundEntityId, &AZ::TransformBus::Events::GetWorldTranslation);
+        return !groundPosition.IsClose(m_sleepGroundPosition);
     }
-    void FirstPersonControllerComponent::SetForwardEventName(const AZStd::string& new_strForward)
+
+    // Stamina regenerates once the pause has ended, so long as it isn't being drained by sprinting or waiting on the cooldown
+    bool FirstPersonControllerComponent::StaminaRegenerates() const
     {
-        m_strForward = new_strForward;
-        AssignConnectInputEvents();
+        return m_regenerateStaminaAutomatically && !m_hot.m_sprintDraining && !m_hot.m_sprintCoolingDown;
     }
-    float FirstPersonControllerComponent::GetForwardScale() const
+
+    float FirstPersonControllerComponent::GetStaminaRegenRate() const
     {
-        return m_forwardScale;
+        return ((m_movementProfile->m_sprintMaxTime + m_sprintPauseTime) / m_movementProfile->m_sprintCooldownTime) * m_movementProfile->m_sprintRegenRate;
     }
-    void FirstPersonControllerComponent::SetForwardScale(const float& new_forwardScale)
+
+    float FirstPersonControllerComponent::GetSprintHeldDurationAt(const double& time) const
     {
-        m_forwardScale = new_forwardScale;
+        if(!StaminaRegenerates())
+            return m_hot.m_sprintHeldDuration;
+
+        const double regenTime = time - AZStd::max(m_hot.m_sprintHeldDurationTime, m_hot.m_sprintPauseEnd);
+        if(regenTime <= 0.0)
+            return m_hot.m_sprintHeldDuration;
+
+        return AZStd::max(m_hot.m_sprintHeldDuration - float(regenTime) * GetStaminaRegenRate(), 0.f);
     }
-    float FirstPersonControllerComponent::GetForwardInputValue() const
+
+    // Time at which the regenerating held duration reaches zero
+    double FirstPersonControllerComponent::GetStaminaCappedTime() const
     {
-        return m_forwardValue;
+        if(!StaminaRegenerates() || m_hot.m_sprintHeldDuration <= 0.f)
+            return AZStd::numeric_limits<double>::max();
+
+        return AZStd::max(m_hot.m_sprintHeldDurationTime, m_hot.m_sprintPauseEnd) + m_hot.m_sprintHeldDuration / GetStaminaRegenRate();
     }
-    void FirstPersonControllerComponent::SetForwardInputValue(const float& new_forwardValue)
+
+    double FirstPersonControllerComponent::GetNextTimerEventTime() const
     {
-        m_forwardValue = new_forwardValue;
+        const double cooldownEnd = m_hot.m_sprintCoolingDown ? m_hot.m_sprintCooldownEnd : AZStd::numeric_limits<double>::max();
+        return AZStd::min(cooldownEnd, GetStaminaCappedTime());
     }
-    AZStd::string FirstPersonControllerComponent::GetBackEventName() const
+
+    // Store the held duration reached so far, so that the regeneration continues from it after the parameters change
+    void FirstPersonControllerComponent::FoldSprintHeldDuration()
     {
-        return m_strBack;
+        const double now = m_hot.m_timerClock;
+        m_hot.m_sprintHeldDuration = GetSprintHeldDurationAt(now);
+        m_hot.m_sprintHeldDurationTime = AZStd::max(now, m_hot.m_sprintHeldDurationTime);
     }
-    void FirstPersonControllerComponent::SetBackEventName(const AZStd::string& new_strBack)
+
+    // Advances the movement by one step, leaving the velocity to be applied in m_hot.m_prevTargetVelocity
+    void FirstPersonControllerComponent::SimulateStep(const float& deltaTime)
     {
-        m_strBack = new_strBack;
-        AssignConnectInputEvents();
+        // Each step, including each fixed substep, moves the timer clock to its own end so that the timers are stamped
+        // with the same times that per-step timers would have reached
+        m_hot.m_timerClock += deltaTime;
+
+        CheckGrounded(deltaTime);
+
+        if(m_hot.m_grounded)
+            CrouchManager(deltaTime);
+
+        // So long as the character is grounded or depending on how the update X&Y velocity while jumping
+        // boolean values are set, and based on the state of jumping/falling, update the X&Y velocity accordingly
+        if(m_hot.m_grounded || (m_updateXYAscending && m_updateXYDescending && !m_updateXYOnlyNearGround)
+           || ((m_updateXYAscending && m_hot.m_applyVelocityZ >= 0.f) && (!m_updateXYOnlyNearGround || m_hot.m_groundClose))
+           || ((m_updateXYDescending && m_hot.m_applyVelocityZ <= 0.f) && (!m_updateXYOnlyNearGround || m_hot.m_groundClose)) )
+            UpdateVelocityXY(deltaTime);
+
+        UpdateVelocityZ(deltaTime);
+
+        // Track the sum of the normal vectors for the velocity's XY plane if its set
+        if(m_velocityXCrossYTracksNormal)
+            SetVelocityXCrossYDirection(GetGroundSumNormalsDirection());
+
+        AZ::Vector3 addVelocityHeading = m_addVelocityHeading;
+        // Rotate addVelocityHeading so it's with respect to the character's heading
+        if(!addVelocityHeading.IsZero())
+            addVelocityHeading = AZ::Quaternion::CreateRotationZ(m_hot.m_currentHeading).TransformVector(m_addVelocityHeading);
+        // Tilt the XY velocity plane based on m_velocityXCrossYDirection
+        m_hot.m_prevTargetVelocity = TiltVectorXCrossY((m_hot.m_applyVelocityXY + AZ::Vector2(m_addVelocityWorld) + AZ::Vector2(addVelocityHeading) + m_separationVelocityXY), m_velocityXCrossYDirection);
+        // Change the +Z direction based on m_velocityZPosDirection
+        m_hot.m_prevTargetVelocity += (m_hot.m_applyVelocityZ + m_addVelocityWorld.GetZ() + m_addVelocityHeading.GetZ()) * m_velocityZPosDirection;
+    }
+
+    void FirstPersonControllerComponent::SubmitVelocity(const AZ::Vector3& velocity)
+    {
+        // Placed here for when CharacterControllerComponent::SetUpDirection() is implemented
+        /* Physics::CharacterRequestBus::Event(GetEntityId(),
+              &Physics::CharacterRequestBus::Events::SetUpDirection, m_sphereCastsAxisDirectionPose); */
+
+        if(!m_addVelocityForTimestepVsTick)
+            Physics::CharacterRequestBus::Event(GetEntityId(),
+                &Physics::CharacterRequestBus::Events::AddVelocityForTick,
+                velocity);
+        else
+            Physics::CharacterRequestBus::Event(GetEntityId(),
+                &Physics::CharacterRequestBus::Events::AddVelocityForPhysicsTimestep,
+                velocity);
+    }
+
+    // Runs as many steps at the fixed step rate as are due on this frame, then applies the velocity interpolated
+    // between the last two steps by the fraction of a step that remains accumulated
+    void FirstPersonControllerComponent::FixedStepTick(const float& deltaTime)
+    {
+        // Compared against the current velocity on the next frame to determine whether something was hit
+        m_hot.m_prevPrevTargetVelocity = m_fixedStepSubmittedVelocity;
+
+        const float stepTime = 1.f / m_fixedStepRate;
+        m_fixedStepAccumulator += deltaTime;
+
+        AZ::u32 substeps = 0;
+        while(m_fixedStepAccumulator >= stepTime && substeps < m_fixedStepMaxSubsteps)
+        {
+            m_fixedStepPrevVelocity = m_hot.m_prevTargetVelocity;
+            SimulateStep(stepTime);
+            m_fixedStepAccumulator -= stepTime;
+            ++substeps;
+        }
+
+        // Drop the time that couldn't be simulated within the substep limit
+        if(m_fixedStepAccumulator >= stepTime)
+            m_fixedStepAccumulator = fmod(m_fixedStepAccumulator, stepTime);
+
+        m_fixedStepSubmittedVelocity = m_fixedStepPrevVelocity.Lerp(m_hot.m_prevTargetVelocity, m_fixedStepAccumulator / stepTime);
+        SubmitVelocity(m_fixedStepSubmittedVelocity);
+    }
+
+    void FirstPersonControllerComponent::UpdateStateSnapshot()
+    {
+        FirstPersonControllerState state;
+        state.m_prevTargetVelocityWorld = m_hot.m_prevTargetVelocity;
+        state.m_applyVelocityXY = m_hot.m_applyVelocityXY;
+        state.m_applyVelocityZ = m_hot.m_applyVelocityZ;
+        state.m_accelerating = m_hot.m_accelerating;
+        state.m_hitSomething = m_hot.m_hitSomething;
+        state.m_gravityPrevented = m_hot.m_gravityPrevented;
+
+        state.m_airTime = GetAirTime();
+        state.m_grounded = m_hot.m_grounded;
+        state.m_groundClose = m_hot.m_groundClose;
+        state.m_jumpHeld = m_hot.m_jumpHeld;
+        state.m_secondJump = m_hot.m_secondJump;
+        state.m_headHit = m_hot.m_headHit;
+
+        state.m_crouchedPercentage = GetCrouchedPercentage();
+        state.m_crouching = m_hot.m_crouching;
+        state.m_crouched = m_hot.m_crouched;
+        state.m_standing = m_hot.m_standing;
+        state.m_standPrevented = m_hot.m_standPrevented;
+
+        state.m_staminaPercentage = GetStaminaPercentage();
+        state.m_sprintCooldown = GetSprintCooldown();
+        state.m_sprinting = GetSprinting();
+        state.m_staminaIncreasing = m_hot.m_staminaIncreasing;
+        state.m_staminaDecreasing = m_hot.m_staminaDecreasing;
+
+        state.m_heading = m_hot.m_currentHeading;
+        state.m_pitch = m_hot.m_currentPitch;
+
+        state.m_position = GetEntity()->GetTransform()->GetWorldTM().GetTranslation();
+
+        m_publishedState.Publish(state);
+    }
+
+    // Event Notification methods for use in scripts
+    void FirstPersonControllerComponent::OnGroundHit(){}
+    void FirstPersonControllerComponent::OnGroundSoonHit(){}
+    void FirstPersonControllerComponent::OnUngrounded(){}
+    void FirstPersonControllerComponent::OnStartedFalling(){}
+    void FirstPersonControllerComponent::OnJumpApogeeReached(){}
+    void FirstPersonControllerComponent::OnStartedMoving(){}
+    void FirstPersonControllerComponent::OnTargetVelocityReached(){}
+    void FirstPersonControllerComponent::OnStopped(){}
+    void FirstPersonControllerComponent::OnTopWalkSpeedReached(){}
+    void FirstPersonControllerComponent::OnTopSprintSpeedReached(){}
+    void FirstPersonControllerComponent::OnHeadHit(){}
+    void FirstPersonControllerComponent::OnHitSomething(){}
+    void FirstPersonControllerComponent::OnGravityPrevented(){}
+    void FirstPersonControllerComponent::OnCrouched(){}
+    void FirstPersonControllerComponent::OnStoodUp(){}
+    void FirstPersonControllerComponent::OnStandPrevented(){}
+    void FirstPersonControllerComponent::OnStartedCrouching(){}
+    void FirstPersonControllerComponent::OnStartedStanding(){}
+    void FirstPersonControllerComponent::OnFirstJump(){}
+    void FirstPersonControllerComponent::OnSecondJump(){}
+    void FirstPersonControllerComponent::OnStaminaCapped(){}
+    void FirstPersonControllerComponent::OnStaminaReachedZero(){}
+    void FirstPersonControllerComponent::OnSprintStarted(){}
+    void FirstPersonControllerComponent::OnCooldownStarted(){}
+    void FirstPersonControllerComponent::OnCooldownDone(){}
+
+    // Request Bus getter and setter methods for use in scripts
+    AZ::EntityId FirstPersonControllerComponent::GetActiveCameraEntityId() const
+    {
+        return m_activeCameraEntity->GetId();
+    }
+    void FirstPersonControllerComponent::ReacquireChildEntityIds()
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::ReacquireChildEntityIds>())
+            return;
+        AZ::TransformBus::EventResult(m_children, GetEntityId(), &AZ::TransformBus::Events::GetChildren);
+    }
+    void FirstPersonControllerComponent::ReacquireCapsuleDimensions()
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::ReacquireCapsuleDimensions>())
+            return;
+        PhysX::CharacterControllerRequestBus::EventResult(m_capsuleHeight, GetEntityId(),
+            &PhysX::CharacterControllerRequestBus::Events::GetHeight);
+        PhysX::CharacterControllerRequestBus::EventResult(m_capsuleRadius, GetEntityId(),
+            &PhysX::CharacterControllerRequestBus::Events::GetRadius);
+
+        m_hot.m_capsuleCurrentHeight = m_capsuleHeight;
+
+        UpdateDerivedConstants();
+    }
+    void FirstPersonControllerComponent::ReacquireMaxSlopeAngle()
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::ReacquireMaxSlopeAngle>())
+            return;
+        Physics::CharacterRequestBus::EventResult(m_maxGroundedAngleDegrees, GetEntityId(),
+            &Physics::CharacterRequestBus::Events::GetSlopeLimitDegrees);
+
+        // Set the max grounded angle to be slightly greater than the PhysX Character Controller's
+        // maximum slope angle value
+        m_maxGroundedAngleDegrees += 0.01f;
+
+        UpdateDerivedConstants();
+    }
+    AZStd::string FirstPersonControllerComponent::GetForwardEventName() const
+    {
+        return m_movementProfile->m_forwardEventName;
+    }
+    void FirstPersonControllerComponent::SetForwardEventName(const AZStd::string& new_strForward)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetForwardEventName>(new_strForward))
+            return;
+        OverrideMovementProfile(MovementProfileField::ForwardEventName).m_forwardEventName = new_strForward;
+        AssignConnectInputEvents();
+    }
+    float FirstPersonControllerComponent::GetForwardScale() const
+    {
+        return m_movementProfile->m_forwardScale;
+    }
+    void FirstPersonControllerComponent::SetForwardScale(const float& new_forwardScale)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetForwardScale>(new_forwardScale))
+            return;
+        OverrideMovementProfile(MovementProfileField::ForwardScale).m_forwardScale = new_forwardScale;
+        UpdateDerivedConstants();
+    }
+    float FirstPersonControllerComponent::GetForwardInputValue() const
+    {
+        return m_forwardValue;
+    }
+    void FirstPersonControllerComponent::SetForwardInputValue(const float& new_forwardValue)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetForwardInputValue>(new_forwardValue))
+            return;
+        m_forwardValue = new_forwardValue;
+    }
+    AZStd::string FirstPersonControllerComponent::GetBackEventName() const
+    {
+        return m_movementProfile->m_backEventName;
+    }
+    void FirstPersonControllerComponent::SetBackEventName(const AZStd::string& new_strBack)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetBackEventName>(new_strBack))
+            return;
+        OverrideMovementProfile(MovementProfileField::BackEventName).m_backEventName = new_strBack;
+        AssignConnectInputEvents();
     }
     float FirstPersonControllerComponent::GetBackScale() const
     {
-        return m_backScale;
+        return m_movementProfile->m_backScale;
     }
     void FirstPersonControllerComponent::SetBackScale(const float& new_backScale)
     {
-        m_backScale = new_backScale;
+        if(QueueSetter<&FirstPersonControllerComponent::SetBackScale>(new_backScale))
+            return;
+        OverrideMovementProfile(MovementProfileField::BackScale).m_backScale = new_backScale;
+        UpdateDerivedConstants();
     }
     float FirstPersonControllerComponent::GetBackInputValue() const
     {
@@ -2339,24 +3643,31 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetBackInputValue(const float& new_backValue)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetBackInputValue>(new_backValue))
+            return;
         m_backValue = new_backValue;
     }
     AZStd::string FirstPersonControllerComponent::GetLeftEventName() const
     {
-        return m_strLeft;
+        return m_movementProfile->m_leftEventName;
     }
     void FirstPersonControllerComponent::SetLeftEventName(const AZStd::string& new_strLeft)
     {
-        m_strLeft = new_strLeft;
+        if(QueueSetter<&FirstPersonControllerComponent::SetLeftEventName>(new_strLeft))
+            return;
+        OverrideMovementProfile(MovementProfileField::LeftEventName).m_leftEventName = new_strLeft;
         AssignConnectInputEvents();
     }
     float FirstPersonControllerComponent::GetLeftScale() const
     {
-        return m_leftScale;
+        return m_movementProfile->m_leftScale;
     }
     void FirstPersonControllerComponent::SetLeftScale(const float& new_leftScale)
     {
-        m_leftScale = new_leftScale;
+        if(QueueSetter<&FirstPersonControllerComponent::SetLeftScale>(new_leftScale))
+            return;
+        OverrideMovementProfile(MovementProfileField::LeftScale).m_leftScale = new_leftScale;
+        UpdateDerivedConstants();
     }
     float FirstPersonControllerComponent::GetLeftInputValue() const
     {
@@ -2364,24 +3675,31 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetLeftInputValue(const float& new_leftValue)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetLeftInputValue>(new_leftValue))
+            return;
         m_leftValue = new_leftValue;
     }
     AZStd::string FirstPersonControllerComponent::GetRightEventName() const
     {
-        return m_strRight;
+        return m_movementProfile->m_rightEventName;
     }
     void FirstPersonControllerComponent::SetRightEventName(const AZStd::string& new_strRight)
     {
-        m_strRight = new_strRight;
+        if(QueueSetter<&FirstPersonControllerComponent::SetRightEventName>(new_strRight))
+            return;
+        OverrideMovementProfile(MovementProfileField::RightEventName).m_rightEventName = new_strRight;
         AssignConnectInputEvents();
     }
     float FirstPersonControllerComponent::GetRightScale() const
     {
-        return m_rightScale;
+        return m_movementProfile->m_rightScale;
     }
     void FirstPersonControllerComponent::SetRightScale(const float& new_rightScale)
     {
-        m_rightScale = new_rightScale;
+        if(QueueSetter<&FirstPersonControllerComponent::SetRightScale>(new_rightScale))
+            return;
+        OverrideMovementProfile(MovementProfileField::RightScale).m_rightScale = new_rightScale;
+        UpdateDerivedConstants();
     }
     float FirstPersonControllerComponent::GetRightInputValue() const
     {
@@ -2389,15 +3707,19 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetRightInputValue(const float& new_rightValue)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetRightInputValue>(new_rightValue))
+            return;
         m_rightValue = new_rightValue;
     }
     AZStd::string FirstPersonControllerComponent::GetYawEventName() const
     {
-        return m_strYaw;
+        return m_movementProfile->m_yawEventName;
     }
     void FirstPersonControllerComponent::SetYawEventName(const AZStd::string& new_strYaw)
     {
-        m_strYaw = new_strYaw;
+        if(QueueSetter<&FirstPersonControllerComponent::SetYawEventName>(new_strYaw))
+            return;
+        OverrideMovementProfile(MovementProfileField::YawEventName).m_yawEventName = new_strYaw;
         AssignConnectInputEvents();
     }
     float FirstPersonControllerComponent::GetYawInputValue() const
@@ -2406,15 +3728,19 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetYawInputValue(const float& new_yawValue)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetYawInputValue>(new_yawValue))
+            return;
         m_yawValue = new_yawValue;
     }
     AZStd::string FirstPersonControllerComponent::GetPitchEventName() const
     {
-        return m_strPitch;
+        return m_movementProfile->m_pitchEventName;
     }
     void FirstPersonControllerComponent::SetPitchEventName(const AZStd::string& new_strPitch)
     {
-        m_strPitch = new_strPitch;
+        if(QueueSetter<&FirstPersonControllerComponent::SetPitchEventName>(new_strPitch))
+            return;
+        OverrideMovementProfile(MovementProfileField::PitchEventName).m_pitchEventName = new_strPitch;
         AssignConnectInputEvents();
     }
     float FirstPersonControllerComponent::GetPitchInputValue() const
@@ -2423,15 +3749,19 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetPitchInputValue(const float& new_pitchValue)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetPitchInputValue>(new_pitchValue))
+            return;
         m_pitchValue = new_pitchValue;
     }
     AZStd::string FirstPersonControllerComponent::GetSprintEventName() const
     {
-        return m_strSprint;
+        return m_movementProfile->m_sprintEventName;
     }
     void FirstPersonControllerComponent::SetSprintEventName(const AZStd::string& new_strSprint)
     {
-        m_strSprint = new_strSprint;
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintEventName>(new_strSprint))
+            return;
+        OverrideMovementProfile(MovementProfileField::SprintEventName).m_sprintEventName = new_strSprint;
         AssignConnectInputEvents();
     }
     float FirstPersonControllerComponent::GetSprintInputValue() const
@@ -2440,15 +3770,19 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetSprintInputValue(const float& new_sprintValue)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintInputValue>(new_sprintValue))
+            return;
         m_sprintValue = new_sprintValue;
     }
     AZStd::string FirstPersonControllerComponent::GetCrouchEventName() const
     {
-        return m_strCrouch;
+        return m_movementProfile->m_crouchEventName;
     }
     void FirstPersonControllerComponent::SetCrouchEventName(const AZStd::string& new_strCrouch)
     {
-        m_strCrouch = new_strCrouch;
+        if(QueueSetter<&FirstPersonControllerComponent::SetCrouchEventName>(new_strCrouch))
+            return;
+        OverrideMovementProfile(MovementProfileField::CrouchEventName).m_crouchEventName = new_strCrouch;
         AssignConnectInputEvents();
     }
     float FirstPersonControllerComponent::GetCrouchInputValue() const
@@ -2457,15 +3791,19 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetCrouchInputValue(const float& new_crouchValue)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetCrouchInputValue>(new_crouchValue))
+            return;
         m_crouchValue = new_crouchValue;
     }
     AZStd::string FirstPersonControllerComponent::GetJumpEventName() const
     {
-        return m_strJump;
+        return m_movementProfile->m_jumpEventName;
     }
     void FirstPersonControllerComponent::SetJumpEventName(const AZStd::string& new_strJump)
     {
-        m_strJump = new_strJump;
+        if(QueueSetter<&FirstPersonControllerComponent::SetJumpEventName>(new_strJump))
+            return;
+        OverrideMovementProfile(MovementProfileField::JumpEventName).m_jumpEventName = new_strJump;
         AssignConnectInputEvents();
     }
     float FirstPersonControllerComponent::GetJumpInputValue() const
@@ -2474,16 +3812,20 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetJumpInputValue(const float& new_jumpValue)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetJumpInputValue>(new_jumpValue))
+            return;
         m_jumpValue = new_jumpValue;
     }
     bool FirstPersonControllerComponent::GetGrounded() const
     {
-        return m_grounded;
+        return m_hot.m_grounded;
     }
     void FirstPersonControllerComponent::SetGroundedForTick(const bool& new_grounded)
     {
-        m_scriptGrounded = new_grounded;
-        m_scriptSetGroundTick = true;
+        if(QueueSetter<&FirstPersonControllerComponent::SetGroundedForTick>(new_grounded))
+            return;
+        m_hot.m_scriptGrounded = new_grounded;
+        m_hot.m_scriptSetGroundTick = true;
     }
     AZStd::vector<AzPhysics::SceneQueryHit> FirstPersonControllerComponent::GetGroundSceneQueryHits() const
     {
@@ -2493,12 +3835,46 @@ namespace FirstPersonController
     {
         return m_groundCloseHits;
     }
+    AZStd::span<const AzPhysics::SceneQueryHit> FirstPersonControllerComponent::GetGroundSceneQueryHitsView() const
+    {
+        return AZStd::span<const AzPhysics::SceneQueryHit>(m_groundHits.data(), m_groundHits.size());
+    }
+    AZStd::span<const AzPhysics::SceneQueryHit> FirstPersonControllerComponent::GetGroundCloseSceneQueryHitsView() const
+    {
+        return AZStd::span<const AzPhysics::SceneQueryHit>(m_groundCloseHits.data(), m_groundCloseHits.size());
+    }
+    AZ::u32 FirstPersonControllerComponent::GetGroundSceneQueryHitCount() const
+    {
+        return static_cast<AZ::u32>(m_groundHits.size());
+    }
+    AzPhysics::SceneQueryHit FirstPersonControllerComponent::GetGroundSceneQueryHitByIndex(const AZ::u32& index) const
+    {
+        if(index >= m_groundHits.size())
+        {
+            AZ_Warning("First Person Controller Component", false, "Ground scene query hit index %u is out of range (%zu hits).", index, m_groundHits.size());
+            return AzPhysics::SceneQueryHit();
+        }
+        return m_groundHits[index];
+    }
+    AZ::u32 FirstPersonControllerComponent::GetGroundCloseSceneQueryHitCount() const
+    {
+        return static_cast<AZ::u32>(m_groundCloseHits.size());
+    }
+    AzPhysics::SceneQueryHit FirstPersonControllerComponent::GetGroundCloseSceneQueryHitByIndex(const AZ::u32& index) const
+    {
+        if(index >= m_groundCloseHits.size())
+        {
+            AZ_Warning("First Person Controller Component", false, "Ground close scene query hit index %u is out of range (%zu hits).", index, m_groundCloseHits.size());
+            return AzPhysics::SceneQueryHit();
+        }
+        return m_groundCloseHits[index];
+    }
     AZ::Vector3 FirstPersonControllerComponent::GetGroundSumNormalsDirection() const
     {
         if(m_groundHits.empty())
             return AZ::Vector3::CreateAxisZ();
         AZ::Vector3 sumNormals = AZ::Vector3::CreateZero();
-        for(AzPhysics::SceneQueryHit hit: m_groundHits)
+        for(const AzPhysics::SceneQueryHit& hit: m_groundHits)
             sumNormals += hit.m_normal;
         return sumNormals.GetNormalized();
     }
@@ -2507,7 +3883,7 @@ namespace FirstPersonController
         if(m_groundCloseHits.empty())
             return AZ::Vector3::CreateAxisZ();
         AZ::Vector3 sumNormals = AZ::Vector3::CreateZero();
-        for(AzPhysics::SceneQueryHit hit: m_groundCloseHits)
+        for(const AzPhysics::SceneQueryHit& hit: m_groundCloseHits)
             sumNormals += hit.m_normal;
         return sumNormals.GetNormalized();
     }
@@ -2545,12 +3921,14 @@ namespace FirstPersonController
     }
     bool FirstPersonControllerComponent::GetGroundClose() const
     {
-        return m_groundClose;
+        return m_hot.m_groundClose;
     }
     void FirstPersonControllerComponent::SetGroundCloseForTick(const bool& new_groundClose)
     {
-        m_scriptGroundClose = new_groundClose;
-        m_scriptSetGroundCloseTick = true;
+        if(QueueSetter<&FirstPersonControllerComponent::SetGroundCloseForTick>(new_groundClose))
+            return;
+        m_hot.m_scriptGroundClose = new_groundClose;
+        m_hot.m_scriptSetGroundCloseTick = true;
     }
     AZStd::string FirstPersonControllerComponent::GetGroundedCollisionGroupName() const
     {
@@ -2561,6 +3939,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetGroundedCollisionGroup(const AZStd::string& new_groundedCollisionGroupName)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetGroundedCollisionGroup>(new_groundedCollisionGroupName))
+            return;
         bool success = false;
         AzPhysics::CollisionGroup collisionGroup;
         Physics::CollisionRequestBus::BroadcastResult(success, &Physics::CollisionRequests::TryGetCollisionGroupByName, new_groundedCollisionGroupName, collisionGroup);
@@ -2569,28 +3949,31 @@ namespace FirstPersonController
             m_groundedCollisionGroup = collisionGroup;
             const AzPhysics::CollisionConfiguration& configuration = AZ::Interface<AzPhysics::SystemInterface>::Get()->GetConfiguration()->m_collisionConfig;
             m_groundedCollisionGroupId = configuration.m_collisionGroups.FindGroupIdByName(new_groundedCollisionGroupName);
+            OverrideMovementProfile(MovementProfileField::GroundedCollisionGroup).m_groundedCollisionGroup = new_groundedCollisionGroupName;
         }
     }
     float FirstPersonControllerComponent::GetAirTime() const
     {
-        return m_airTime;
+        return float(m_hot.m_timerClock - m_hot.m_airborneSince);
     }
     float FirstPersonControllerComponent::GetGravity() const
     {
-        return m_gravity;
+        return m_movementProfile->m_gravity;
     }
     void FirstPersonControllerComponent::SetGravity(const float& new_gravity)
     {
-        m_gravity = new_gravity;
-        UpdateJumpMaxHoldTime();
+        if(QueueSetter<&FirstPersonControllerComponent::SetGravity>(new_gravity))
+            return;
+        OverrideMovementProfile(MovementProfileField::Gravity).m_gravity = new_gravity;
+        UpdateDerivedConstants();
     }
     AZ::Vector3 FirstPersonControllerComponent::GetPrevTargetVelocityWorld() const
     {
-        return m_prevTargetVelocity;
+        return m_hot.m_prevTargetVelocity;
     }
     AZ::Vector3 FirstPersonControllerComponent::GetPrevTargetVelocityHeading() const
     {
-        return AZ::Quaternion::CreateRotationZ(-m_currentHeading).TransformVector(m_prevTargetVelocity);
+        return AZ::Quaternion::CreateRotationZ(-m_hot.m_currentHeading).TransformVector(m_hot.m_prevTargetVelocity);
     }
     float FirstPersonControllerComponent::GetVelocityCloseTolerance() const
     {
@@ -2598,6 +3981,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetVelocityCloseTolerance(const float& new_velocityCloseTolerance)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetVelocityCloseTolerance>(new_velocityCloseTolerance))
+            return;
         m_velocityCloseTolerance = new_velocityCloseTolerance;
     }
     AZ::Vector3 FirstPersonControllerComponent::GetVelocityXCrossYDirection() const
@@ -2606,6 +3991,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetVelocityXCrossYDirection(const AZ::Vector3& new_velocityXCrossYDirection)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetVelocityXCrossYDirection>(new_velocityXCrossYDirection))
+            return;
         m_velocityXCrossYDirection = new_velocityXCrossYDirection.GetNormalized();
         if(m_velocityXCrossYDirection.IsZero())
             m_velocityXCrossYDirection = AZ::Vector3::CreateAxisZ();
@@ -2616,6 +4003,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetVelocityZPosDirection(const AZ::Vector3& new_velocityZPosDirection)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetVelocityZPosDirection>(new_velocityZPosDirection))
+            return;
         m_velocityZPosDirection = new_velocityZPosDirection.GetNormalized();
         if(m_velocityZPosDirection.IsZero())
             m_velocityZPosDirection = AZ::Vector3::CreateAxisZ();
@@ -2626,9 +4015,12 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetSphereCastsAxisDirectionPose(const AZ::Vector3& new_sphereCastsAxisDirectionPose)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetSphereCastsAxisDirectionPose>(new_sphereCastsAxisDirectionPose))
+            return;
         m_sphereCastsAxisDirectionPose = new_sphereCastsAxisDirectionPose;
         if(m_sphereCastsAxisDirectionPose.IsZero())
             m_sphereCastsAxisDirectionPose = AZ::Vector3::CreateAxisZ();
+        UpdateDerivedConstants();
     }
     bool FirstPersonControllerComponent::GetVelocityXCrossYTracksNormal() const
     {
@@ -2636,6 +4028,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetVelocityXCrossYTracksNormal(const bool& new_velocityXCrossYTracksNormal)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetVelocityXCrossYTracksNormal>(new_velocityXCrossYTracksNormal))
+            return;
         m_velocityXCrossYTracksNormal = new_velocityXCrossYTracksNormal;
     }
     AZ::Vector3 FirstPersonControllerComponent::GetVectorAnglesBetweenVectorsRadians(const AZ::Vector3& v1, const AZ::Vector3& v2)
@@ -2661,28 +4055,34 @@ namespace FirstPersonController
     }
     float FirstPersonControllerComponent::GetJumpHeldGravityFactor() const
     {
-        return m_jumpHeldGravityFactor;
+        return m_movementProfile->m_jumpHeldGravityFactor;
     }
     void FirstPersonControllerComponent::SetJumpHeldGravityFactor(const float& new_jumpHeldGravityFactor)
     {
-        m_jumpHeldGravityFactor = new_jumpHeldGravityFactor;
-        UpdateJumpMaxHoldTime();
+        if(QueueSetter<&FirstPersonControllerComponent::SetJumpHeldGravityFactor>(new_jumpHeldGravityFactor))
+            return;
+        OverrideMovementProfile(MovementProfileField::JumpHeldGravityFactor).m_jumpHeldGravityFactor = new_jumpHeldGravityFactor;
+        UpdateDerivedConstants();
     }
     float FirstPersonControllerComponent::GetJumpFallingGravityFactor() const
     {
-        return m_jumpFallingGravityFactor;
+        return m_movementProfile->m_jumpFallingGravityFactor;
     }
     void FirstPersonControllerComponent::SetJumpFallingGravityFactor(const float& new_jumpFallingGravityFactor)
     {
-        m_jumpFallingGravityFactor = new_jumpFallingGravityFactor;
+        if(QueueSetter<&FirstPersonControllerComponent::SetJumpFallingGravityFactor>(new_jumpFallingGravityFactor))
+            return;
+        OverrideMovementProfile(MovementProfileField::JumpFallingGravityFactor).m_jumpFallingGravityFactor = new_jumpFallingGravityFactor;
     }
     float FirstPersonControllerComponent::GetJumpAccelFactor() const
     {
-        return m_jumpAccelFactor;
+        return m_movementProfile->m_jumpAccelFactor;
     }
     void FirstPersonControllerComponent::SetJumpAccelFactor(const float& new_jumpAccelFactor)
     {
-        m_jumpAccelFactor = new_jumpAccelFactor;
+        if(QueueSetter<&FirstPersonControllerComponent::SetJumpAccelFactor>(new_jumpAccelFactor))
+            return;
+        OverrideMovementProfile(MovementProfileField::JumpAccelFactor).m_jumpAccelFactor = new_jumpAccelFactor;
     }
     bool FirstPersonControllerComponent::GetUpdateXYAscending() const
     {
@@ -2690,6 +4090,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetUpdateXYAscending(const bool& new_updateXYAscending)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetUpdateXYAscending>(new_updateXYAscending))
+            return;
         m_updateXYAscending = new_updateXYAscending;
     }
     bool FirstPersonControllerComponent::GetUpdateXYDescending() const
@@ -2698,6 +4100,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetUpdateXYDescending(const bool& new_updateXYDescending)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetUpdateXYDescending>(new_updateXYDescending))
+            return;
         m_updateXYDescending = new_updateXYDescending;
     }
     bool FirstPersonControllerComponent::GetUpdateXYOnlyNearGround() const
@@ -2706,6 +4110,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetUpdateXYOnlyNearGround(const bool& new_updateXYOnlyNearGround)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetUpdateXYOnlyNearGround>(new_updateXYOnlyNearGround))
+            return;
         m_updateXYOnlyNearGround = new_updateXYOnlyNearGround;
     }
     bool FirstPersonControllerComponent::GetAddVelocityForTimestepVsTick() const
@@ -2714,6 +4120,7 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetAddVelocityForTimestepVsTick(const bool& new_addVelocityForTimestepVsTick)
     {
+        WakeForRequest();
         m_addVelocityForTimestepVsTick = new_addVelocityForTimestepVsTick;
 
         if(m_addVelocityForTimestepVsTick)
@@ -2750,14 +4157,322 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetPhysicsTimestepScaleFactor(const float& new_physicsTimestepScaleFactor)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetPhysicsTimestepScaleFactor>(new_physicsTimestepScaleFactor))
+            return;
         m_physicsTimestepScaleFactor = new_physicsTimestepScaleFactor;
     }
+    bool FirstPersonControllerComponent::GetFixedStepTick() const
+    {
+        return m_fixedStepTick;
+    }
+    void FirstPersonControllerComponent::SetFixedStepTick(const bool& new_fixedStepTick)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetFixedStepTick>(new_fixedStepTick))
+            return;
+        m_fixedStepTick = new_fixedStepTick;
+        m_fixedStepAccumulator = 0.f;
+        m_fixedStepPrevVelocity = m_hot.m_prevTargetVelocity;
+    }
+    float FirstPersonControllerComponent::GetFixedStepRate() const
+    {
+        return m_fixedStepRate;
+    }
+    void FirstPersonControllerComponent::SetFixedStepRate(const float& new_fixedStepRate)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetFixedStepRate>(new_fixedStepRate))
+            return;
+        if(new_fixedStepRate <= 0.f)
+        {
+            AZ_Warning("First Person Controller Component", false, "Fixed Step Rate must be greater than zero.");
+            return;
+        }
+        m_fixedStepRate = new_fixedStepRate;
+    }
+    AZ::u32 FirstPersonControllerComponent::GetFixedStepMaxSubsteps() const
+    {
+        return m_fixedStepMaxSubsteps;
+    }
+    void FirstPersonControllerComponent::SetFixedStepMaxSubsteps(const AZ::u32& new_fixedStepMaxSubsteps)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetFixedStepMaxSubsteps>(new_fixedStepMaxSubsteps))
+            return;
+        if(new_fixedStepMaxSubsteps < 1)
+        {
+            AZ_Warning("First Person Controller Component", false, "Fixed Step Max Substeps must be at least one.");
+            return;
+        }
+        m_fixedStepMaxSubsteps = new_fixedStepMaxSubsteps;
+    }
+    bool FirstPersonControllerComponent::GetGroundQueriesOncePerFrame() const
+    {
+        return m_groundQueriesOncePerFrame;
+    }
+    void FirstPersonControllerComponent::SetGroundQueriesOncePerFrame(const bool& new_groundQueriesOncePerFrame)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetGroundQueriesOncePerFrame>(new_groundQueriesOncePerFrame))
+            return;
+        m_groundQueriesOncePerFrame = new_groundQueriesOncePerFrame;
+    }
+    bool FirstPersonControllerComponent::GetHeadQueryOncePerFrame() const
+    {
+        return m_headQueryOncePerFrame;
+    }
+    void FirstPersonControllerComponent::SetHeadQueryOncePerFrame(const bool& new_headQueryOncePerFrame)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetHeadQueryOncePerFrame>(new_headQueryOncePerFrame))
+            return;
+        m_headQueryOncePerFrame = new_headQueryOncePerFrame;
+    }
+    bool FirstPersonControllerComponent::GetStandQueryOncePerFrame() const
+    {
+        return m_standQueryOncePerFrame;
+    }
+    void FirstPersonControllerComponent::SetStandQueryOncePerFrame(const bool& new_standQueryOncePerFrame)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetStandQueryOncePerFrame>(new_standQueryOncePerFrame))
+            return;
+        m_standQueryOncePerFrame = new_standQueryOncePerFrame;
+    }
+    bool FirstPersonControllerComponent::GetQueueSetters() const
+    {
+        return m_queueSetters;
+    }
+    void FirstPersonControllerComponent::SetQueueSetters(const bool& new_queueSetters)
+    {
+        WakeForRequest();
+        m_queueSetters = new_queueSetters;
+    }
+    bool FirstPersonControllerComponent::GetQueueInput() const
+    {
+        return m_queueInput;
+    }
+    void FirstPersonControllerComponent::SetQueueInput(const bool& new_queueInput)
+    {
+        WakeForRequest();
+        m_queueInput = new_queueInput;
+    }
+    bool FirstPersonControllerComponent::GetDeferNotifications() const
+    {
+        return m_deferNotifications;
+    }
+    void FirstPersonControllerComponent::SetDeferNotifications(const bool& new_deferNotifications)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetDeferNotifications>(new_deferNotifications))
+            return;
+        // Deliver anything still pending so that no notification is lost when switching to immediate dispatch
+        if(m_deferNotifications && !new_deferNotifications)
+            FlushNotifications(0.f);
+        m_deferNotifications = new_deferNotifications;
+    }
+    bool FirstPersonControllerComponent::GetNotificationsEdgeTriggered() const
+    {
+        return m_notificationsEdgeTriggered;
+    }
+    void FirstPersonControllerComponent::SetNotificationsEdgeTriggered(const bool& new_notificationsEdgeTriggered)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetNotificationsEdgeTriggered>(new_notificationsEdgeTriggered))
+            return;
+        m_notificationsEdgeTriggered = new_notificationsEdgeTriggered;
+        m_prevFlushedNotifications = 0;
+    }
+    float FirstPersonControllerComponent::GetNotificationMinInterval() const
+    {
+        return m_notificationMinInterval;
+    }
+    void FirstPersonControllerComponent::SetNotificationMinInterval(const float& new_notificationMinInterval)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetNotificationMinInterval>(new_notificationMinInterval))
+            return;
+        m_notificationMinInterval = new_notificationMinInterval;
+    }
+    bool FirstPersonControllerComponent::GetSleepWhenIdle() const
+    {
+        return m_sleepWhenIdle;
+    }
+    void FirstPersonControllerComponent::SetSleepWhenIdle(const bool& new_sleepWhenIdle)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetSleepWhenIdle>(new_sleepWhenIdle))
+            return;
+        m_sleepWhenIdle = new_sleepWhenIdle;
+        if(!m_sleepWhenIdle)
+            WakeUp();
+    }
+    float FirstPersonControllerComponent::GetSleepIdleDelay() const
+    {
+        return m_sleepIdleDelay;
+    }
+    void FirstPersonControllerComponent::SetSleepIdleDelay(const float& new_sleepIdleDelay)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetSleepIdleDelay>(new_sleepIdleDelay))
+            return;
+        m_sleepIdleDelay = new_sleepIdleDelay;
+    }
+    bool FirstPersonControllerComponent::GetSleeping() const
+    {
+        return m_sleeping.load(AZStd::memory_order_relaxed);
+    }
+    void FirstPersonControllerComponent::WakeUp()
+    {
+        m_sleepIdleTime = 0.f;
+        m_sleeping.store(false, AZStd::memory_order_relaxed);
+    }
+    AZ::u32 FirstPersonControllerComponent::GetUpdateTier() const
+    {
+        return m_updateTier;
+    }
+    void FirstPersonControllerComponent::SetUpdateTier(const AZ::u32& new_updateTier, const AZ::u32& new_updateTierPhase)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetUpdateTier, false>(new_updateTier, new_updateTierPhase))
+            return;
+        const AZ::u32 updateTier = AZStd::min(new_updateTier, 3u);
+        if(updateTier == m_updateTier && new_updateTierPhase == m_updateTierPhase)
+            return;
+        m_updateTier = updateTier;
+        m_updateTierPhase = new_updateTierPhase;
+        // Start the new cadence from its phase, the time already skipped is still given to the next step that runs
+        m_updateTierStepCounter[0] = m_updateTierStepCounter[1] = 0;
+    }
+    bool FirstPersonControllerComponent::GetCrowdSeparation() const
+    {
+        return m_crowdSeparation;
+    }
+    void FirstPersonControllerComponent::SetCrowdSeparation(const bool& new_crowdSeparation)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetCrowdSeparation>(new_crowdSeparation))
+            return;
+        m_crowdSeparation = new_crowdSeparation;
+        if(!m_crowdSeparation)
+            m_separationVelocityXY = AZ::Vector2::CreateZero();
+    }
+    float FirstPersonControllerComponent::GetSeparationRadius() const
+    {
+        return m_separationRadius;
+    }
+    void FirstPersonControllerComponent::SetSeparationRadius(const float& new_separationRadius)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetSeparationRadius>(new_separationRadius))
+            return;
+        m_separationRadius = new_separationRadius;
+    }
+    float FirstPersonControllerComponent::GetSeparationSpeed() const
+    {
+        return m_separationSpeed;
+    }
+    void FirstPersonControllerComponent::SetSeparationSpeed(const float& new_separationSpeed)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetSeparationSpeed>(new_separationSpeed))
+            return;
+        m_separationSpeed = new_separationSpeed;
+    }
+    AZ::Vector2 FirstPersonControllerComponent::GetSeparationVelocityXY() const
+    {
+        return m_separationVelocityXY;
+    }
+    void FirstPersonControllerComponent::ResetRuntimeState()
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::ResetRuntimeState>())
+            return;
+        // Undo the crouch's changes to the camera height and the capsule before the state that tracks them is cleared
+        if(m_activeCameraEntity != nullptr && m_hot.m_cameraLocalZTravelDistance != 0.f)
+        {
+            AZ::TransformInterface* cameraTransform = m_activeCameraEntity->GetTransform();
+            cameraTransform->SetLocalZ(cameraTransform->GetLocalZ() - m_hot.m_cameraLocalZTravelDistance);
+        }
+        if(m_hot.m_capsuleCurrentHeight != m_capsuleHeight)
+            PhysX::CharacterControllerRequestBus::Event(GetEntityId(),
+                &PhysX::CharacterControllerRequestBus::Events::Resize, m_capsuleHeight);
+
+        m_hot = HotState();
+        m_hot.m_capsuleCurrentHeight = m_capsuleHeight;
+
+        m_forwardValue = m_backValue = m_leftValue = m_rightValue = 0.f;
+        m_yawValue = m_pitchValue = 0.f;
+        m_sprintValue = 1.f;
+        m_crouchValue = m_jumpValue = 0.f;
+        m_newLookRotationDelta = AZ::Quaternion::CreateZero();
+        m_scriptTargetVelocityXY = AZ::Vector2::CreateZero();
+        m_prevVelocityXCrossYDirection = m_velocityXCrossYDirection;
+        m_separationVelocityXY = AZ::Vector2::CreateZero();
+
+        // The cached scene query results belong to the previous location, so they're dropped and the once per frame
+        // queries are made again on the next step even when it's on the same frame
+        m_groundHits.clear();
+        m_groundCloseHits.clear();
+        m_headHitEntityIds.clear();
+        m_standPreventedEntityIds.clear();
+        m_headImpact = FirstPersonControllerImpact();
+        m_groundQueryFrame = m_headQueryFrame = m_standQueryFrame = 0;
+
+        // Input that was submitted before the reset is dropped, unless a step is consuming it right now
+        if(!m_inputCommandsConsuming.exchange(true, AZStd::memory_order_acquire))
+        {
+            while(m_inputCommands.Front())
+                m_inputCommands.PopFront();
+            m_inputCommandsConsuming.store(false, AZStd::memory_order_release);
+        }
+        ClearMovementCommands();
+        m_pendingNotifications.store(0, AZStd::memory_order_relaxed);
+        m_prevFlushedNotifications = 0;
+
+        m_fixedStepAccumulator = 0.f;
+        m_fixedStepPrevVelocity = m_fixedStepSubmittedVelocity = AZ::Vector3::CreateZero();
+        m_updateTierSkippedTime[0] = m_updateTierSkippedTime[1] = 0.f;
+        WakeUp();
+
+        UpdateStateSnapshot();
+    }
+    void FirstPersonControllerComponent::Teleport(const AZ::Vector3& new_position, const float& new_heading)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::Teleport>(new_position, new_heading))
+            return;
+        ResetRuntimeState();
+
+        AZ::TransformInterface* transform = GetEntity()->GetTransform();
+        transform->SetWorldRotationQuaternion(AZ::Quaternion::CreateRotationZ(new_heading));
+        transform->SetWorldTranslation(new_position);
+        Physics::CharacterRequestBus::Event(GetEntityId(), &Physics::CharacterRequestBus::Events::SetBasePosition, new_position);
+
+        // Level the camera's pitch
+        if(m_activeCameraEntity != nullptr)
+        {
+            AZ::TransformInterface* cameraTransform = m_activeCameraEntity->GetTransform();
+            const AZ::Vector3 cameraRotation = cameraTransform->GetLocalRotation();
+            cameraTransform->SetLocalRotation(AZ::Vector3(0.f, cameraRotation.GetY(), cameraRotation.GetZ()));
+        }
+
+        m_hot.m_currentHeading = new_heading;
+        UpdateStateSnapshot();
+    }
+    bool FirstPersonControllerComponent::GetPooled() const
+    {
+        return m_pooled;
+    }
+    void FirstPersonControllerComponent::SetPooled(const bool& new_pooled)
+    {
+        WakeForRequest();
+        const bool pooledChanged = (new_pooled != m_pooled);
+        m_pooled = new_pooled;
+        if(m_pooled)
+            ResetRuntimeState();
+
+        // A pooled character is taken out of the simulation, so that the controllers parked at the same position don't
+        // collide with each other or with anything else. It's put back at wherever it was moved to while pooled.
+        if(pooledChanged)
+        {
+            if(m_pooled)
+                AzPhysics::SimulatedBodyComponentRequestsBus::Event(GetEntityId(), &AzPhysics::SimulatedBodyComponentRequests::DisablePhysics);
+            else
+                AzPhysics::SimulatedBodyComponentRequestsBus::Event(GetEntityId(), &AzPhysics::SimulatedBodyComponentRequests::EnablePhysics);
+        }
+    }
     bool FirstPersonControllerComponent::GetScriptSetsTargetVelocityXY() const
     {
         return m_scriptSetsTargetVelocityXY;
     }
     void FirstPersonControllerComponent::SetScriptSetsTargetVelocityXY(const bool& new_scriptSetsTargetVelocityXY)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetScriptSetsTargetVelocityXY>(new_scriptSetsTargetVelocityXY))
+            return;
         m_scriptSetsTargetVelocityXY = new_scriptSetsTargetVelocityXY;
     }
     AZ::Vector2 FirstPersonControllerComponent::GetTargetVelocityXY() const
@@ -2766,37 +4481,46 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetTargetVelocityXY(const AZ::Vector2& new_scriptTargetVelocityXY)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetTargetVelocityXY>(new_scriptTargetVelocityXY))
+            return;
         m_scriptTargetVelocityXY = new_scriptTargetVelocityXY;
     }
     AZ::Vector2 FirstPersonControllerComponent::GetCorrectedVelocityXY() const
     {
-        return m_correctedVelocityXY;
+        return m_hot.m_correctedVelocityXY;
     }
     void FirstPersonControllerComponent::SetCorrectedVelocityXY(const AZ::Vector2& new_correctedVelocityXY)
     {
-        m_hitSomething = true;
-        m_correctedVelocityXY = new_correctedVelocityXY;
+        if(QueueSetter<&FirstPersonControllerComponent::SetCorrectedVelocityXY>(new_correctedVelocityXY))
+            return;
+        m_hot.m_hitSomething = true;
+        m_hot.m_correctedVelocityXY = new_correctedVelocityXY;
     }
     float FirstPersonControllerComponent::GetCorrectedVelocityZ() const
     {
-        return m_correctedVelocityZ;
+        return m_hot.m_correctedVelocityZ;
     }
     void FirstPersonControllerComponent::SetCorrectedVelocityZ(const float& new_correctedVelocityZ)
     {
-        m_hitSomething = true;
-        m_correctedVelocityZ = new_correctedVelocityZ;
+        if(QueueSetter<&FirstPersonControllerComponent::SetCorrectedVelocityZ>(new_correctedVelocityZ))
+            return;
+        m_hot.m_hitSomething = true;
+        m_hot.m_correctedVelocityZ = new_correctedVelocityZ;
     }
     AZ::Vector2 FirstPersonControllerComponent::GetApplyVelocityXY() const
     {
-        return m_applyVelocityXY;
+        return m_hot.m_applyVelocityXY;
     }
     void FirstPersonControllerComponent::SetApplyVelocityXY(const AZ::Vector2& new_applyVelocityXY)
     {
-        m_applyVelocityXY = new_applyVelocityXY;
+        if(QueueSetter<&FirstPersonControllerComponent::SetApplyVelocityXY>(new_applyVelocityXY))
+            return;
+        m_hot.m_applyVelocityXY = new_applyVelocityXY;
         if(m_instantVelocityRotation)
-            m_prevApplyVelocityXY = AZ::Vector2(AZ::Quaternion::CreateRotationZ(-m_currentHeading).TransformVector(AZ::Vector3(m_applyVelocityXY)));
+            m_hot.m_prevApplyVelocityXY = AZ::Vector2(AZ::Quaternion::CreateRotationZ(-m_hot.m_currentHeading).TransformVector(AZ::Vector3(m_hot.m_applyVelocityXY)));
         else
-            m_prevApplyVelocityXY = m_applyVelocityXY;
+            m_hot.m_prevApplyVelocityXY = m_hot.m_applyVelocityXY;
+        m_hot.m_analyticVelocityRestart = true;
     }
     AZ::Vector3 FirstPersonControllerComponent::GetAddVelocityWorld() const
     {
@@ -2804,6 +4528,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetAddVelocityWorld(const AZ::Vector3& new_addVelocityWorld)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetAddVelocityWorld>(new_addVelocityWorld))
+            return;
         m_addVelocityWorld = new_addVelocityWorld;
     }
     AZ::Vector3 FirstPersonControllerComponent::GetAddVelocityHeading() const
@@ -2812,49 +4538,62 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetAddVelocityHeading(const AZ::Vector3& new_addVelocityHeading)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetAddVelocityHeading>(new_addVelocityHeading))
+            return;
         m_addVelocityHeading = new_addVelocityHeading;
     }
     float FirstPersonControllerComponent::GetApplyVelocityZ() const
     {
-        return m_applyVelocityZ;
+        return m_hot.m_applyVelocityZ;
     }
     void FirstPersonControllerComponent::SetApplyVelocityZ(const float& new_applyVelocityZ)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetApplyVelocityZ>(new_applyVelocityZ))
+            return;
         SetGroundedForTick(false);
-        m_applyVelocityZ = new_applyVelocityZ;
+        m_hot.m_applyVelocityZ = new_applyVelocityZ;
+        m_hot.m_applyVelocityZCurrentDelta = 0.f;
     }
     float FirstPersonControllerComponent::GetJumpInitialVelocity() const
     {
-        return m_jumpInitialVelocity;
+        return m_movementProfile->m_jumpInitialVelocity;
     }
     void FirstPersonControllerComponent::SetJumpInitialVelocity(const float& new_jumpInitialVelocity)
     {
-        m_jumpInitialVelocity = new_jumpInitialVelocity;
-        UpdateJumpMaxHoldTime();
+        if(QueueSetter<&FirstPersonControllerComponent::SetJumpInitialVelocity>(new_jumpInitialVelocity))
+            return;
+        OverrideMovementProfile(MovementProfileField::JumpInitialVelocity).m_jumpInitialVelocity = new_jumpInitialVelocity;
+        UpdateDerivedConstants();
     }
     float FirstPersonControllerComponent::GetJumpSecondInitialVelocity() const
     {
-        return m_jumpSecondInitialVelocity;
+        return m_movementProfile->m_jumpSecondInitialVelocity;
     }
     void FirstPersonControllerComponent::SetJumpSecondInitialVelocity(const float& new_jumpSecondInitialVelocity)
     {
-        m_jumpSecondInitialVelocity = new_jumpSecondInitialVelocity;
+        if(QueueSetter<&FirstPersonControllerComponent::SetJumpSecondInitialVelocity>(new_jumpSecondInitialVelocity))
+            return;
+        OverrideMovementProfile(MovementProfileField::JumpSecondInitialVelocity).m_jumpSecondInitialVelocity = new_jumpSecondInitialVelocity;
     }
     bool FirstPersonControllerComponent::GetJumpReqRepress() const
     {
-        return m_jumpReqRepress;
+        return m_hot.m_jumpReqRepress;
     }
     void FirstPersonControllerComponent::SetJumpReqRepress(const bool& new_jumpReqRepress)
     {
-        m_jumpReqRepress = new_jumpReqRepress;
+        if(QueueSetter<&FirstPersonControllerComponent::SetJumpReqRepress>(new_jumpReqRepress))
+            return;
+        m_hot.m_jumpReqRepress = new_jumpReqRepress;
     }
     bool FirstPersonControllerComponent::GetJumpHeld() const
     {
-        return m_jumpHeld;
+        return m_hot.m_jumpHeld;
     }
     void FirstPersonControllerComponent::SetJumpHeld(const bool& new_jumpHeld)
     {
-        m_jumpHeld = new_jumpHeld;
+        if(QueueSetter<&FirstPersonControllerComponent::SetJumpHeld>(new_jumpHeld))
+            return;
+        m_hot.m_jumpHeld = new_jumpHeld;
     }
     bool FirstPersonControllerComponent::GetDoubleJump() const
     {
@@ -2862,6 +4601,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetDoubleJump(const bool& new_doubleJumpEnabled)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetDoubleJump>(new_doubleJumpEnabled))
+            return;
         m_doubleJumpEnabled = new_doubleJumpEnabled;
     }
     float FirstPersonControllerComponent::GetGroundedOffset() const
@@ -2870,6 +4611,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetGroundedOffset(const float& new_groundedSphereCastOffset)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetGroundedOffset>(new_groundedSphereCastOffset))
+            return;
         m_groundedSphereCastOffset = new_groundedSphereCastOffset;
     }
     float FirstPersonControllerComponent::GetGroundCloseOffset() const
@@ -2878,16 +4621,59 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetGroundCloseOffset(const float& new_groundCloseSphereCastOffset)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetGroundCloseOffset>(new_groundCloseSphereCastOffset))
+            return;
         m_groundCloseSphereCastOffset = new_groundCloseSphereCastOffset;
     }
+    bool FirstPersonControllerComponent::GetGroundCloseTimeToImpact() const
+    {
+        return m_groundCloseTimeToImpact;
+    }
+    void FirstPersonControllerComponent::SetGroundCloseTimeToImpact(const bool& new_groundCloseTimeToImpact)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetGroundCloseTimeToImpact>(new_groundCloseTimeToImpact))
+            return;
+        m_groundCloseTimeToImpact = new_groundCloseTimeToImpact;
+    }
+    float FirstPersonControllerComponent::GetGroundCloseTimeThreshold() const
+    {
+        return m_groundCloseTimeThreshold;
+    }
+    void FirstPersonControllerComponent::SetGroundCloseTimeThreshold(const float& new_groundCloseTimeThreshold)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetGroundCloseTimeThreshold>(new_groundCloseTimeThreshold))
+            return;
+        m_groundCloseTimeThreshold = new_groundCloseTimeThreshold;
+    }
+    float FirstPersonControllerComponent::GetTimeToGroundImpact() const
+    {
+        return m_hot.m_timeToGroundImpact;
+    }
     float FirstPersonControllerComponent::GetJumpHoldDistance() const
     {
-        return m_jumpHoldDistance;
+        return m_movementProfile->m_jumpHoldDistance;
     }
     void FirstPersonControllerComponent::SetJumpHoldDistance(const float& new_jumpHoldDistance)
     {
-        m_jumpHoldDistance = new_jumpHoldDistance;
-        UpdateJumpMaxHoldTime();
+        if(QueueSetter<&FirstPersonControllerComponent::SetJumpHoldDistance>(new_jumpHoldDistance))
+            return;
+        OverrideMovementProfile(MovementProfileField::JumpHoldDistance).m_jumpHoldDistance = new_jumpHoldDistance;
+        UpdateDerivedConstants();
+    }
+    bool FirstPersonControllerComponent::GetExactVelocityZ() const
+    {
+        return m_exactVelocityZ;
+    }
+    void FirstPersonControllerComponent::SetExactVelocityZ(const bool& new_exactVelocityZ)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetExactVelocityZ>(new_exactVelocityZ))
+            return;
+        // Fold any carried end of step difference back into the applied velocity when switching integrators
+        if(m_exactVelocityZ && !new_exactVelocityZ)
+            m_hot.m_applyVelocityZ += m_hot.m_applyVelocityZCurrentDelta;
+        m_hot.m_applyVelocityZCurrentDelta = 0.f;
+        m_hot.m_applyVelocityZPrevDelta = 0.f;
+        m_exactVelocityZ = new_exactVelocityZ;
     }
     float FirstPersonControllerComponent::GetJumpHeadSphereCastOffset() const
     {
@@ -2895,6 +4681,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetJumpHeadSphereCastOffset(const float& new_jumpHeadSphereCastOffset)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetJumpHeadSphereCastOffset>(new_jumpHeadSphereCastOffset))
+            return;
         m_jumpHeadSphereCastOffset = new_jumpHeadSphereCastOffset;
     }
     bool FirstPersonControllerComponent::GetHeadHitSetsApogee() const
@@ -2903,15 +4691,19 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetHeadHitSetsApogee(const bool& new_headHitSetsApogee)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetHeadHitSetsApogee>(new_headHitSetsApogee))
+            return;
         m_headHitSetsApogee = new_headHitSetsApogee;
     }
     bool FirstPersonControllerComponent::GetHeadHit() const
     {
-        return m_headHit;
+        return m_hot.m_headHit;
     }
     void FirstPersonControllerComponent::SetHeadHit(const bool& new_headHit)
     {
-        m_headHit = new_headHit;
+        if(QueueSetter<&FirstPersonControllerComponent::SetHeadHit>(new_headHit))
+            return;
+        m_hot.m_headHit = new_headHit;
     }
     bool FirstPersonControllerComponent::GetJumpHeadIgnoreDynamicRigidBodies() const
     {
@@ -2919,6 +4711,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetJumpHeadIgnoreDynamicRigidBodies(const bool& new_jumpHeadIgnoreDynamicRigidBodies)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetJumpHeadIgnoreDynamicRigidBodies>(new_jumpHeadIgnoreDynamicRigidBodies))
+            return;
         m_jumpHeadIgnoreDynamicRigidBodies = new_jumpHeadIgnoreDynamicRigidBodies;
     }
     AZStd::string FirstPersonControllerComponent::GetHeadCollisionGroupName() const
@@ -2930,6 +4724,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetHeadCollisionGroupByName(const AZStd::string& new_headCollisionGroupName)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetHeadCollisionGroupByName>(new_headCollisionGroupName))
+            return;
         bool success = false;
         AzPhysics::CollisionGroup collisionGroup;
         Physics::CollisionRequestBus::BroadcastResult(success, &Physics::CollisionRequests::TryGetCollisionGroupByName, new_headCollisionGroupName, collisionGroup);
@@ -2938,23 +4734,43 @@ namespace FirstPersonController
             m_headCollisionGroup = collisionGroup;
             const AzPhysics::CollisionConfiguration& configuration = AZ::Interface<AzPhysics::SystemInterface>::Get()->GetConfiguration()->m_collisionConfig;
             m_headCollisionGroupId = configuration.m_collisionGroups.FindGroupIdByName(new_headCollisionGroupName);
+            OverrideMovementProfile(MovementProfileField::JumpHeadCollisionGroup).m_jumpHeadCollisionGroup = new_headCollisionGroupName;
         }
     }
     AZStd::vector<AZ::EntityId> FirstPersonControllerComponent::GetHeadHitEntityIds() const
     {
         return m_headHitEntityIds;
     }
+    AZStd::span<const AZ::EntityId> FirstPersonControllerComponent::GetHeadHitEntityIdsView() const
+    {
+        return AZStd::span<const AZ::EntityId>(m_headHitEntityIds.data(), m_headHitEntityIds.size());
+    }
+    AZ::u32 FirstPersonControllerComponent::GetHeadHitEntityIdCount() const
+    {
+        return static_cast<AZ::u32>(m_headHitEntityIds.size());
+    }
+    AZ::EntityId FirstPersonControllerComponent::GetHeadHitEntityIdByIndex(const AZ::u32& index) const
+    {
+        if(index >= m_headHitEntityIds.size())
+        {
+            AZ_Warning("First Person Controller Component", false, "Head hit EntityId index %u is out of range (%zu EntityIds).", index, m_headHitEntityIds.size());
+            return AZ::EntityId();
+        }
+        return m_headHitEntityIds[index];
+    }
     bool FirstPersonControllerComponent::GetStandPrevented() const
     {
-        return m_standPrevented;
+        return m_hot.m_standPrevented;
     }
     void FirstPersonControllerComponent::SetStandPrevented(const bool& new_standPrevented)
     {
-        m_standPrevented = new_standPrevented;
-        if(m_standPrevented)
-            m_standPreventedViaScript = true;
+        if(QueueSetter<&FirstPersonControllerComponent::SetStandPrevented>(new_standPrevented))
+            return;
+        m_hot.m_standPrevented = new_standPrevented;
+        if(m_hot.m_standPrevented)
+            m_hot.m_standPreventedViaScript = true;
         else
-            m_standPreventedViaScript = false;
+            m_hot.m_standPreventedViaScript = false;
     }
     bool FirstPersonControllerComponent::GetStandIgnoreDynamicRigidBodies() const
     {
@@ -2962,6 +4778,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetStandIgnoreDynamicRigidBodies(const bool& new_standIgnoreDynamicRigidBodies)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetStandIgnoreDynamicRigidBodies>(new_standIgnoreDynamicRigidBodies))
+            return;
         m_standIgnoreDynamicRigidBodies = new_standIgnoreDynamicRigidBodies;
     }
     AZStd::string FirstPersonControllerComponent::GetStandCollisionGroupName() const
@@ -2973,6 +4791,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetStandCollisionGroupByName(const AZStd::string& new_standCollisionGroupName)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetStandCollisionGroupByName>(new_standCollisionGroupName))
+            return;
         bool success = false;
         AzPhysics::CollisionGroup collisionGroup;
         Physics::CollisionRequestBus::BroadcastResult(success, &Physics::CollisionRequests::TryGetCollisionGroupByName, new_standCollisionGroupName, collisionGroup);
@@ -2981,19 +4801,40 @@ namespace FirstPersonController
             m_standCollisionGroup = collisionGroup;
             const AzPhysics::CollisionConfiguration& configuration = AZ::Interface<AzPhysics::SystemInterface>::Get()->GetConfiguration()->m_collisionConfig;
             m_standCollisionGroupId = configuration.m_collisionGroups.FindGroupIdByName(new_standCollisionGroupName);
+            OverrideMovementProfile(MovementProfileField::StandCollisionGroup).m_standCollisionGroup = new_standCollisionGroupName;
         }
     }
     AZStd::vector<AZ::EntityId> FirstPersonControllerComponent::GetStandPreventedEntityIds() const
     {
         return m_standPreventedEntityIds;
     }
+    AZStd::span<const AZ::EntityId> FirstPersonControllerComponent::GetStandPreventedEntityIdsView() const
+    {
+        return AZStd::span<const AZ::EntityId>(m_standPreventedEntityIds.data(), m_standPreventedEntityIds.size());
+    }
+    AZ::u32 FirstPersonControllerComponent::GetStandPreventedEntityIdCount() const
+    {
+        return static_cast<AZ::u32>(m_standPreventedEntityIds.size());
+    }
+    AZ::EntityId FirstPersonControllerComponent::GetStandPreventedEntityIdByIndex(const AZ::u32& index) const
+    {
+        if(index >= m_standPreventedEntityIds.size())
+        {
+            AZ_Warning("First Person Controller Component", false, "Stand prevented EntityId index %u is out of range (%zu EntityIds).", index, m_standPreventedEntityIds.size());
+            return AZ::EntityId();
+        }
+        return m_standPreventedEntityIds[index];
+    }
     float FirstPersonControllerComponent::GetGroundSphereCastsRadiusPercentageIncrease() const
     {
         return m_groundSphereCastsRadiusPercentageIncrease;
     }
     void FirstPersonControllerComponent::SetGroundSphereCastsRadiusPercentageIncrease(const float& new_groundSphereCastsRadiusPercentageIncrease)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetGroundSphereCastsRadiusPercentageIncrease>(new_groundSphereCastsRadiusPercentageIncrease))
+            return;
         m_groundSphereCastsRadiusPercentageIncrease = new_groundSphereCastsRadiusPercentageIncrease;
+        UpdateDerivedConstants();
     }
     float FirstPersonControllerComponent::GetMaxGroundedAngleDegrees() const
     {
@@ -3001,67 +4842,83 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetMaxGroundedAngleDegrees(const float& new_maxGroundedAngleDegrees)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetMaxGroundedAngleDegrees>(new_maxGroundedAngleDegrees))
+            return;
         m_maxGroundedAngleDegrees = new_maxGroundedAngleDegrees;
+        UpdateDerivedConstants();
     }
     float FirstPersonControllerComponent::GetTopWalkSpeed() const
     {
-        return m_speed;
+        return m_movementProfile->m_topWalkSpeed;
     }
     void FirstPersonControllerComponent::SetTopWalkSpeed(const float& new_speed)
     {
-        m_speed = new_speed;
+        if(QueueSetter<&FirstPersonControllerComponent::SetTopWalkSpeed>(new_speed))
+            return;
+        OverrideMovementProfile(MovementProfileField::TopWalkSpeed).m_topWalkSpeed = new_speed;
+        UpdateDerivedConstants();
     }
     float FirstPersonControllerComponent::GetWalkAcceleration() const
     {
-        return m_accel;
+        return m_movementProfile->m_walkAcceleration;
     }
     void FirstPersonControllerComponent::SetWalkAcceleration(const float& new_accel)
     {
-        m_accel = new_accel;
+        if(QueueSetter<&FirstPersonControllerComponent::SetWalkAcceleration>(new_accel))
+            return;
+        OverrideMovementProfile(MovementProfileField::WalkAcceleration).m_walkAcceleration = new_accel;
     }
     float FirstPersonControllerComponent::GetTotalLerpTime() const
     {
-        return m_totalLerpTime;
+        return m_hot.m_totalLerpTime;
     }
     void FirstPersonControllerComponent::SetTotalLerpTime(const float& new_totalLerpTime)
     {
-        m_totalLerpTime = new_totalLerpTime;
+        if(QueueSetter<&FirstPersonControllerComponent::SetTotalLerpTime>(new_totalLerpTime))
+            return;
+        m_hot.m_totalLerpTime = new_totalLerpTime;
     }
     float FirstPersonControllerComponent::GetLerpTime() const
     {
-        return m_lerpTime;
+        return m_hot.m_lerpTime;
     }
     void FirstPersonControllerComponent::SetLerpTime(const float& new_lerpTime)
     {
-        m_lerpTime = new_lerpTime;
+        if(QueueSetter<&FirstPersonControllerComponent::SetLerpTime>(new_lerpTime))
+            return;
+        m_hot.m_lerpTime = new_lerpTime;
     }
     float FirstPersonControllerComponent::GetDecelerationFactor() const
     {
-        return m_decel;
+        return m_movementProfile->m_deceleration;
     }
     void FirstPersonControllerComponent::SetDecelerationFactor(const float& new_decel)
     {
-        m_decel = new_decel;
+        if(QueueSetter<&FirstPersonControllerComponent::SetDecelerationFactor>(new_decel))
+            return;
+        OverrideMovementProfile(MovementProfileField::Deceleration).m_deceleration = new_decel;
     }
     float FirstPersonControllerComponent::GetOpposingDecel() const
     {
-        return m_opposingDecel;
+        return m_movementProfile->m_opposingDeceleration;
     }
     void FirstPersonControllerComponent::SetOpposingDecel(const float& new_opposingDecel)
     {
-        m_opposingDecel = new_opposingDecel;
+        if(QueueSetter<&FirstPersonControllerComponent::SetOpposingDecel>(new_opposingDecel))
+            return;
+        OverrideMovementProfile(MovementProfileField::OpposingDeceleration).m_opposingDeceleration = new_opposingDecel;
     }
     bool FirstPersonControllerComponent::GetAccelerating() const
     {
-        return m_accelerating;
+        return m_hot.m_accelerating;
     }
     bool FirstPersonControllerComponent::GetDecelerationFactorApplied() const
     {
-        return m_decelerationFactorApplied;
+        return m_hot.m_decelerationFactorApplied;
     }
     bool FirstPersonControllerComponent::GetOpposingDecelFactorApplied() const
     {
-        return m_opposingDecelFactorApplied;
+        return m_hot.m_opposingDecelFactorApplied;
     }
     bool FirstPersonControllerComponent::GetInstantVelocityRotation() const
     {
@@ -3069,7 +4926,24 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetInstantVelocityRotation(const bool& new_instantVelocityRotation)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetInstantVelocityRotation>(new_instantVelocityRotation))
+            return;
         m_instantVelocityRotation = new_instantVelocityRotation;
+        // The analytic velocity is kept in the frame that this selects, so it restarts from the last applied velocity
+        m_hot.m_analyticVelocityRestart = true;
+    }
+    bool FirstPersonControllerComponent::GetAnalyticVelocityXY() const
+    {
+        return m_analyticVelocityXY;
+    }
+    void FirstPersonControllerComponent::SetAnalyticVelocityXY(const bool& new_analyticVelocityXY)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetAnalyticVelocityXY>(new_analyticVelocityXY))
+            return;
+        m_analyticVelocityXY = new_analyticVelocityXY;
+        // Restart from the last applied velocity so that switching models mid-motion is continuous
+        m_hot.m_lerpTime = 0.f;
+        m_hot.m_analyticVelocityRestart = true;
     }
     bool FirstPersonControllerComponent::GetVelocityXYIgnoresObstacles() const
     {
@@ -3077,6 +4951,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetVelocityXYIgnoresObstacles(const bool& new_velocityXYIgnoresObstacles)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetVelocityXYIgnoresObstacles>(new_velocityXYIgnoresObstacles))
+            return;
         m_velocityXYIgnoresObstacles = new_velocityXYIgnoresObstacles;
     }
     bool FirstPersonControllerComponent::GetGravityIgnoresObstacles() const
@@ -3085,6 +4961,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetGravityIgnoresObstacles(const bool& new_gravityIgnoresObstacles)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetGravityIgnoresObstacles>(new_gravityIgnoresObstacles))
+            return;
         m_gravityIgnoresObstacles = new_gravityIgnoresObstacles;
     }
     bool FirstPersonControllerComponent::GetPosZIgnoresObstacles() const
@@ -3093,6 +4971,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetPosZIgnoresObstacles(const bool& new_posZIgnoresObstacles)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetPosZIgnoresObstacles>(new_posZIgnoresObstacles))
+            return;
         m_posZIgnoresObstacles = new_posZIgnoresObstacles;
     }
     bool FirstPersonControllerComponent::GetJumpAllowedWhenGravityPrevented() const
@@ -3101,144 +4981,173 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetJumpAllowedWhenGravityPrevented(const bool& new_jumpAllowedWhenGravityPrevented)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetJumpAllowedWhenGravityPrevented>(new_jumpAllowedWhenGravityPrevented))
+            return;
         m_jumpAllowedWhenGravityPrevented = new_jumpAllowedWhenGravityPrevented;
     }
     bool FirstPersonControllerComponent::GetHitSomething() const
     {
-        return m_hitSomething;
+        return m_hot.m_hitSomething;
     }
     void FirstPersonControllerComponent::SetHitSomething(const bool& new_hitSomething)
     {
-        m_hitSomething = new_hitSomething;
+        if(QueueSetter<&FirstPersonControllerComponent::SetHitSomething>(new_hitSomething))
+            return;
+        m_hot.m_hitSomething = new_hitSomething;
     }
     bool FirstPersonControllerComponent::GetGravityPrevented() const
     {
-        return m_gravityPrevented[1];
+        return m_hot.m_gravityPrevented;
     }
     void FirstPersonControllerComponent::SetGravityPrevented(const bool& new_gravityPrevented)
     {
-        m_gravityPrevented[0] = m_gravityPrevented[1] = new_gravityPrevented;
+        if(QueueSetter<&FirstPersonControllerComponent::SetGravityPrevented>(new_gravityPrevented))
+            return;
+        m_hot.m_gravityPreventedFirstTick = m_hot.m_gravityPrevented = new_gravityPrevented;
     }
     float FirstPersonControllerComponent::GetSprintScaleForward() const
     {
-        return m_sprintScaleForward;
+        return m_movementProfile->m_sprintScaleForward;
     }
     void FirstPersonControllerComponent::SetSprintScaleForward(const float& new_sprintScaleForward)
     {
-        m_sprintScaleForward = new_sprintScaleForward;
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintScaleForward>(new_sprintScaleForward))
+            return;
+        OverrideMovementProfile(MovementProfileField::SprintScaleForward).m_sprintScaleForward = new_sprintScaleForward;
+        UpdateDerivedConstants();
     }
     float FirstPersonControllerComponent::GetSprintScaleBack() const
     {
-        return m_sprintScaleBack;
+        return m_movementProfile->m_sprintScaleBack;
     }
     void FirstPersonControllerComponent::SetSprintScaleBack(const float& new_sprintScaleBack)
     {
-        m_sprintScaleBack = new_sprintScaleBack;
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintScaleBack>(new_sprintScaleBack))
+            return;
+        OverrideMovementProfile(MovementProfileField::SprintScaleBack).m_sprintScaleBack = new_sprintScaleBack;
+        UpdateDerivedConstants();
     }
     float FirstPersonControllerComponent::GetSprintScaleLeft() const
     {
-        return m_sprintScaleLeft;
+        return m_movementProfile->m_sprintScaleLeft;
     }
     void FirstPersonControllerComponent::SetSprintScaleLeft(const float& new_sprintScaleLeft)
     {
-        m_sprintScaleLeft = new_sprintScaleLeft;
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintScaleLeft>(new_sprintScaleLeft))
+            return;
+        OverrideMovementProfile(MovementProfileField::SprintScaleLeft).m_sprintScaleLeft = new_sprintScaleLeft;
+        UpdateDerivedConstants();
     }
     float FirstPersonControllerComponent::GetSprintScaleRight() const
     {
-        return m_sprintScaleRight;
+        return m_movementProfile->m_sprintScaleRight;
     }
     void FirstPersonControllerComponent::SetSprintScaleRight(const float& new_sprintScaleRight)
     {
-        m_sprintScaleRight = new_sprintScaleRight;
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintScaleRight>(new_sprintScaleRight))
+            return;
+        OverrideMovementProfile(MovementProfileField::SprintScaleRight).m_sprintScaleRight = new_sprintScaleRight;
+        UpdateDerivedConstants();
     }
     float FirstPersonControllerComponent::GetSprintAccelScale() const
     {
-        return m_sprintAccelScale;
+        return m_movementProfile->m_sprintAccelScale;
     }
     void FirstPersonControllerComponent::SetSprintAccelScale(const float& new_sprintAccelScale)
     {
-        m_sprintAccelScale = new_sprintAccelScale;
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintAccelScale>(new_sprintAccelScale))
+            return;
+        OverrideMovementProfile(MovementProfileField::SprintAccelScale).m_sprintAccelScale = new_sprintAccelScale;
     }
     float FirstPersonControllerComponent::GetSprintAccumulatedAccel() const
     {
-        return m_sprintAccumulatedAccel;
+        return m_hot.m_sprintAccumulatedAccel;
     }
     void FirstPersonControllerComponent::SetSprintAccumulatedAccel(const float& new_sprintAccumulatedAccel)
     {
-        m_sprintAccumulatedAccel = new_sprintAccumulatedAccel;
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintAccumulatedAccel>(new_sprintAccumulatedAccel))
+            return;
+        m_hot.m_sprintAccumulatedAccel = new_sprintAccumulatedAccel;
     }
     float FirstPersonControllerComponent::GetSprintMaxTime() const
     {
-        return m_sprintMaxTime;
+        return m_movementProfile->m_sprintMaxTime;
     }
     void FirstPersonControllerComponent::SetSprintMaxTime(const float& new_sprintMaxTime)
     {
-        m_sprintMaxTime = new_sprintMaxTime;
-        m_staminaPercentage = (m_sprintCooldown == 0.f) ? 100.f * (m_sprintMaxTime - m_sprintHeldDuration) / m_sprintMaxTime : 0.f;
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintMaxTime>(new_sprintMaxTime))
+            return;
+        FoldSprintHeldDuration();
+        OverrideMovementProfile(MovementProfileField::SprintMaxTime).m_sprintMaxTime = new_sprintMaxTime;
     }
     float FirstPersonControllerComponent::GetSprintHeldTime() const
     {
-        return m_sprintHeldDuration;
+        return GetSprintHeldDurationAt(m_hot.m_timerClock);
     }
     void FirstPersonControllerComponent::SetSprintHeldTime(const float& new_sprintHeldDuration)
     {
-        const float prevSprintHeldDuration = m_sprintHeldDuration;
-        if(new_sprintHeldDuration <= m_sprintMaxTime)
-            m_sprintHeldDuration = new_sprintHeldDuration;
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintHeldTime>(new_sprintHeldDuration))
+            return;
+        const float prevSprintHeldDuration = GetSprintHeldDurationAt(m_hot.m_timerClock);
+        if(new_sprintHeldDuration <= m_movementProfile->m_sprintMaxTime)
+            m_hot.m_sprintHeldDuration = new_sprintHeldDuration;
         else
-            m_sprintHeldDuration = m_sprintMaxTime;
-        m_staminaPercentage = (m_sprintCooldown == 0.f) ? 100.f * (m_sprintMaxTime - m_sprintHeldDuration) / m_sprintMaxTime : 0.f;
-        if(m_sprintHeldDuration > prevSprintHeldDuration)
+            m_hot.m_sprintHeldDuration = m_movementProfile->m_sprintMaxTime;
+        m_hot.m_sprintHeldDurationTime = m_hot.m_timerClock;
+        if(m_hot.m_sprintHeldDuration > prevSprintHeldDuration)
         {
-            m_staminaDecreasing = true;
-            m_staminaIncreasing = false;
+            m_hot.m_staminaDecreasing = true;
+            m_hot.m_staminaIncreasing = false;
         }
-        else if(m_sprintHeldDuration < prevSprintHeldDuration)
+        else if(m_hot.m_sprintHeldDuration < prevSprintHeldDuration)
         {
-            m_staminaDecreasing = false;
-            m_staminaIncreasing = true;
+            m_hot.m_staminaDecreasing = false;
+            m_hot.m_staminaIncreasing = true;
         }
     }
     float FirstPersonControllerComponent::GetSprintRegenRate() const
     {
-        return m_sprintRegenRate;
+        return m_movementProfile->m_sprintRegenRate;
     }
     void FirstPersonControllerComponent::SetSprintRegenRate(const float& new_sprintRegenRate)
     {
-        m_sprintRegenRate = new_sprintRegenRate;
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintRegenRate>(new_sprintRegenRate))
+            return;
+        FoldSprintHeldDuration();
+        OverrideMovementProfile(MovementProfileField::SprintRegenRate).m_sprintRegenRate = new_sprintRegenRate;
     }
     float FirstPersonControllerComponent::GetStaminaPercentage() const
     {
-        return m_staminaPercentage;
+        if(m_movementProfile->m_sprintMaxTime == 0.f || m_hot.m_sprintCoolingDown)
+            return 0.f;
+        return 100.f * (m_movementProfile->m_sprintMaxTime - GetSprintHeldDurationAt(m_hot.m_timerClock)) / m_movementProfile->m_sprintMaxTime;
     }
     void FirstPersonControllerComponent::SetStaminaPercentage(const float& new_staminaPercentage)
     {
-        const float prevStaminaPercentage = m_staminaPercentage;
-        if(new_staminaPercentage >= 0.f && new_staminaPercentage <= 100.f)
-            m_staminaPercentage = new_staminaPercentage;
-        else if(new_staminaPercentage < 0.f)
-            m_staminaPercentage = 0.f;
-        else
-            m_staminaPercentage = 100.f;
-        m_sprintHeldDuration = m_sprintMaxTime - m_sprintMaxTime * m_staminaPercentage / 100.f;
-        if(m_staminaPercentage < prevStaminaPercentage)
+        if(QueueSetter<&FirstPersonControllerComponent::SetStaminaPercentage>(new_staminaPercentage))
+            return;
+        const float prevStaminaPercentage = GetStaminaPercentage();
+        const float staminaPercentage = AZ::GetClamp(new_staminaPercentage, 0.f, 100.f);
+        m_hot.m_sprintHeldDuration = m_movementProfile->m_sprintMaxTime - m_movementProfile->m_sprintMaxTime * staminaPercentage / 100.f;
+        m_hot.m_sprintHeldDurationTime = m_hot.m_timerClock;
+        if(staminaPercentage < prevStaminaPercentage)
         {
-            m_staminaDecreasing = true;
-            m_staminaIncreasing = false;
+            m_hot.m_staminaDecreasing = true;
+            m_hot.m_staminaIncreasing = false;
         }
-        else if(m_staminaPercentage > prevStaminaPercentage)
+        else if(staminaPercentage > prevStaminaPercentage)
         {
-            m_staminaDecreasing = false;
-            m_staminaIncreasing = true;
+            m_hot.m_staminaDecreasing = false;
+            m_hot.m_staminaIncreasing = true;
         }
     }
     bool FirstPersonControllerComponent::GetStaminaIncreasing() const
     {
-        return m_staminaIncreasing;
+        return m_hot.m_staminaIncreasing;
     }
     bool FirstPersonControllerComponent::GetStaminaDecreasing() const
     {
-        return m_staminaDecreasing;
+        return m_hot.m_staminaDecreasing;
     }
     bool FirstPersonControllerComponent::GetSprintUsesStamina() const
     {
@@ -3246,6 +5155,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetSprintUsesStamina(const bool& new_sprintUsesStamina)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintUsesStamina>(new_sprintUsesStamina))
+            return;
         m_sprintUsesStamina = new_sprintUsesStamina;
     }
     bool FirstPersonControllerComponent::GetRegenerateStaminaAutomatically() const
@@ -3254,29 +5165,41 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetRegenerateStaminaAutomatically(const bool& new_regenerateStaminaAutomatically)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetRegenerateStaminaAutomatically>(new_regenerateStaminaAutomatically))
+            return;
+        FoldSprintHeldDuration();
         m_regenerateStaminaAutomatically = new_regenerateStaminaAutomatically;
     }
     bool FirstPersonControllerComponent::GetSprinting() const
     {
-        if(m_sprintVelocityAdjust != 1.f && (m_standing || m_sprintWhileCrouched))
+        if(m_hot.m_sprintVelocityAdjust != 1.f && (m_hot.m_standing || m_sprintWhileCrouched))
             return true;
         return false;
     }
     float FirstPersonControllerComponent::GetSprintCooldownTime() const
     {
-        return m_sprintCooldownTime;
+        return m_movementProfile->m_sprintCooldownTime;
     }
     void FirstPersonControllerComponent::SetSprintCooldownTime(const float& new_sprintCooldownTime)
     {
-        m_sprintCooldownTime = new_sprintCooldownTime;
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintCooldownTime>(new_sprintCooldownTime))
+            return;
+        FoldSprintHeldDuration();
+        OverrideMovementProfile(MovementProfileField::SprintCooldownTime).m_sprintCooldownTime = new_sprintCooldownTime;
     }
     float FirstPersonControllerComponent::GetSprintCooldown() const
     {
-        return m_sprintCooldown;
+        if(!m_hot.m_sprintCoolingDown)
+            return 0.f;
+        return float(AZStd::max(m_hot.m_sprintCooldownEnd - m_hot.m_timerClock, 0.0));
     }
     void FirstPersonControllerComponent::SetSprintCooldown(const float& new_sprintCooldown)
     {
-        m_sprintCooldown = new_sprintCooldown;
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintCooldown>(new_sprintCooldown))
+            return;
+        FoldSprintHeldDuration();
+        m_hot.m_sprintCoolingDown = (new_sprintCooldown != 0.f);
+        m_hot.m_sprintCooldownEnd = m_hot.m_timerClock + new_sprintCooldown;
     }
     float FirstPersonControllerComponent::GetSprintPauseTime() const
     {
@@ -3284,15 +5207,22 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetSprintPauseTime(const float& new_sprintPauseTime)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintPauseTime>(new_sprintPauseTime))
+            return;
+        FoldSprintHeldDuration();
         m_sprintPauseTime = new_sprintPauseTime;
+        MarkMovementProfileOverride(MovementProfileField::SprintPauseTime);
     }
     float FirstPersonControllerComponent::GetSprintPause() const
     {
-        return m_sprintPause;
+        return float(AZStd::max(m_hot.m_sprintPauseEnd - m_hot.m_timerClock, 0.0));
     }
     void FirstPersonControllerComponent::SetSprintPause(const float& new_sprintPause)
     {
-        m_sprintPause = new_sprintPause;
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintPause>(new_sprintPause))
+            return;
+        FoldSprintHeldDuration();
+        m_hot.m_sprintPauseEnd = m_hot.m_timerClock + new_sprintPause;
     }
     bool FirstPersonControllerComponent::GetSprintBackwards() const
     {
@@ -3300,6 +5230,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetSprintBackwards(const bool& new_sprintBackwards)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintBackwards>(new_sprintBackwards))
+            return;
         m_sprintBackwards = new_sprintBackwards;
     }
     bool FirstPersonControllerComponent::GetSprintWhileCrouched() const
@@ -3308,6 +5240,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetSprintWhileCrouched(const bool& new_sprintWhileCrouched)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintWhileCrouched>(new_sprintWhileCrouched))
+            return;
         m_sprintWhileCrouched = new_sprintWhileCrouched;
     }
     bool FirstPersonControllerComponent::GetSprintViaScript() const
@@ -3316,6 +5250,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetSprintViaScript(const bool& new_sprintViaScript)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintViaScript>(new_sprintViaScript))
+            return;
         m_sprintViaScript = new_sprintViaScript;
     }
     bool FirstPersonControllerComponent::GetSprintEnableDisableScript() const
@@ -3324,27 +5260,31 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetSprintEnableDisableScript(const bool& new_sprintEnableDisableScript)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetSprintEnableDisableScript>(new_sprintEnableDisableScript))
+            return;
         m_sprintEnableDisableScript = new_sprintEnableDisableScript;
     }
     bool FirstPersonControllerComponent::GetCrouching() const
     {
-        return m_crouching;
+        return m_hot.m_crouching;
     }
     void FirstPersonControllerComponent::SetCrouching(const bool& new_crouching)
     {
-        m_crouching = new_crouching;
+        if(QueueSetter<&FirstPersonControllerComponent::SetCrouching>(new_crouching))
+            return;
+        m_hot.m_crouching = new_crouching;
     }
     bool FirstPersonControllerComponent::GetCrouched() const
     {
-        return m_crouched;
+        return m_hot.m_crouched;
     }
     bool FirstPersonControllerComponent::GetStanding() const
     {
-        return m_standing;
+        return m_hot.m_standing;
     }
     float FirstPersonControllerComponent::GetCrouchedPercentage() const
     {
-        return abs(m_cameraLocalZTravelDistance) / m_crouchDistance * 100.f;
+        return abs(m_hot.m_cameraLocalZTravelDistance) / m_derived.m_crouchDistance * 100.f;
     }
     bool FirstPersonControllerComponent::GetCrouchScriptLocked() const
     {
@@ -3352,39 +5292,51 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetCrouchScriptLocked(const bool& new_crouchScriptLocked)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetCrouchScriptLocked>(new_crouchScriptLocked))
+            return;
         m_crouchScriptLocked = new_crouchScriptLocked;
     }
     float FirstPersonControllerComponent::GetCrouchScale() const
     {
-        return m_crouchScale;
+        return m_movementProfile->m_crouchScale;
     }
     void FirstPersonControllerComponent::SetCrouchScale(const float& new_crouchScale)
     {
-        m_crouchScale = new_crouchScale;
+        if(QueueSetter<&FirstPersonControllerComponent::SetCrouchScale>(new_crouchScale))
+            return;
+        OverrideMovementProfile(MovementProfileField::CrouchScale).m_crouchScale = new_crouchScale;
+        UpdateDerivedConstants();
     }
     float FirstPersonControllerComponent::GetCrouchDistance() const
     {
-        return m_crouchDistance;
+        return m_movementProfile->m_crouchDistance;
     }
     void FirstPersonControllerComponent::SetCrouchDistance(const float& new_crouchDistance)
     {
-        m_crouchDistance = new_crouchDistance;
+        if(QueueSetter<&FirstPersonControllerComponent::SetCrouchDistance>(new_crouchDistance))
+            return;
+        OverrideMovementProfile(MovementProfileField::CrouchDistance).m_crouchDistance = new_crouchDistance;
+        UpdateDerivedConstants();
     }
     float FirstPersonControllerComponent::GetCrouchTime() const
     {
-        return m_crouchTime;
+        return m_movementProfile->m_crouchTime;
     }
     void FirstPersonControllerComponent::SetCrouchTime(const float& new_crouchTime)
     {
-        m_crouchTime = new_crouchTime;
+        if(QueueSetter<&FirstPersonControllerComponent::SetCrouchTime>(new_crouchTime))
+            return;
+        OverrideMovementProfile(MovementProfileField::CrouchTime).m_crouchTime = new_crouchTime;
     }
     float FirstPersonControllerComponent::GetStandTime() const
     {
-        return m_standTime;
+        return m_movementProfile->m_standTime;
     }
     void FirstPersonControllerComponent::SetStandTime(const float& new_standTime)
     {
-        m_standTime = new_standTime;
+        if(QueueSetter<&FirstPersonControllerComponent::SetStandTime>(new_standTime))
+            return;
+        OverrideMovementProfile(MovementProfileField::StandTime).m_standTime = new_standTime;
     }
     float FirstPersonControllerComponent::GetUncrouchHeadSphereCastOffset() const
     {
@@ -3392,6 +5344,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetUncrouchHeadSphereCastOffset(const float& new_uncrouchHeadSphereCastOffset)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetUncrouchHeadSphereCastOffset>(new_uncrouchHeadSphereCastOffset))
+            return;
         m_uncrouchHeadSphereCastOffset = new_uncrouchHeadSphereCastOffset;
     }
     bool FirstPersonControllerComponent::GetCrouchEnableToggle() const
@@ -3400,6 +5354,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetCrouchEnableToggle(const bool& new_crouchEnableToggle)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetCrouchEnableToggle>(new_crouchEnableToggle))
+            return;
         m_crouchEnableToggle = new_crouchEnableToggle;
     }
     bool FirstPersonControllerComponent::GetCrouchJumpCausesStanding() const
@@ -3408,6 +5364,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetCrouchJumpCausesStanding(const bool& new_crouchJumpCausesStanding)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetCrouchJumpCausesStanding>(new_crouchJumpCausesStanding))
+            return;
         m_crouchJumpCausesStanding = new_crouchJumpCausesStanding;
     }
     bool FirstPersonControllerComponent::GetCrouchSprintCausesStanding() const
@@ -3416,6 +5374,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetCrouchSprintCausesStanding(const bool& new_crouchSprintCausesStanding)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetCrouchSprintCausesStanding>(new_crouchSprintCausesStanding))
+            return;
         m_crouchSprintCausesStanding = new_crouchSprintCausesStanding;
     }
     bool FirstPersonControllerComponent::GetCrouchPriorityWhenSprintPressed() const
@@ -3424,6 +5384,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetCrouchPriorityWhenSprintPressed(const bool& new_crouchPriorityWhenSprintPressed)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetCrouchPriorityWhenSprintPressed>(new_crouchPriorityWhenSprintPressed))
+            return;
         m_crouchPriorityWhenSprintPressed = new_crouchPriorityWhenSprintPressed;
     }
     float FirstPersonControllerComponent::GetCameraYawSensitivity() const
@@ -3432,6 +5394,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetCameraYawSensitivity(const float& new_yawSensitivity)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetCameraYawSensitivity>(new_yawSensitivity))
+            return;
         m_yawSensitivity = new_yawSensitivity;
     }
     float FirstPersonControllerComponent::GetCameraPitchSensitivity() const
@@ -3440,6 +5404,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetCameraPitchSensitivity(const float& new_pitchSensitivity)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetCameraPitchSensitivity>(new_pitchSensitivity))
+            return;
         m_pitchSensitivity = new_pitchSensitivity;
     }
     float FirstPersonControllerComponent::GetCameraPitchMaxAngleRadians() const
@@ -3448,6 +5414,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetCameraPitchMaxAngleRadians(const float& new_cameraPitchMaxAngleRadians)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetCameraPitchMaxAngleRadians>(new_cameraPitchMaxAngleRadians))
+            return;
         m_cameraPitchMaxAngle = new_cameraPitchMaxAngleRadians;
     }
     float FirstPersonControllerComponent::GetCameraPitchMaxAngleDegrees() const
@@ -3456,6 +5424,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetCameraPitchMaxAngleDegrees(const float& new_cameraPitchMaxAngleDegrees)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetCameraPitchMaxAngleDegrees>(new_cameraPitchMaxAngleDegrees))
+            return;
         m_cameraPitchMaxAngle = (new_cameraPitchMaxAngleDegrees * AZ::Constants::TwoPi/360.f);
     }
     float FirstPersonControllerComponent::GetCameraPitchMinAngleRadians() const
@@ -3464,6 +5434,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetCameraPitchMinAngleRadians(const float& new_cameraPitchMinAngleRadians)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetCameraPitchMinAngleRadians>(new_cameraPitchMinAngleRadians))
+            return;
         m_cameraPitchMinAngle = new_cameraPitchMinAngleRadians;
     }
     float FirstPersonControllerComponent::GetCameraPitchMinAngleDegrees() const
@@ -3472,6 +5444,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetCameraPitchMinAngleDegrees(const float& new_cameraPitchMinAngleDegrees)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetCameraPitchMinAngleDegrees>(new_cameraPitchMinAngleDegrees))
+            return;
         m_cameraPitchMinAngle = (new_cameraPitchMinAngleDegrees * AZ::Constants::TwoPi/360.f);
     }
     float FirstPersonControllerComponent::GetCameraRotationDampFactor() const
@@ -3480,6 +5454,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetCameraRotationDampFactor(const float& new_rotationDamp)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetCameraRotationDampFactor>(new_rotationDamp))
+            return;
         m_rotationDamp = new_rotationDamp;
     }
     bool FirstPersonControllerComponent::GetCameraSlerpInsteadOfLerpRotation() const
@@ -3488,6 +5464,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetCameraSlerpInsteadOfLerpRotation(const bool& new_cameraSlerpInsteadOfLerpRotation)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetCameraSlerpInsteadOfLerpRotation>(new_cameraSlerpInsteadOfLerpRotation))
+            return;
         m_cameraSlerpInsteadOfLerpRotation = new_cameraSlerpInsteadOfLerpRotation;
     }
     bool FirstPersonControllerComponent::GetUpdateCameraYawIgnoresInput() const
@@ -3496,6 +5474,8 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetUpdateCameraYawIgnoresInput(const bool& new_updateCameraYawIgnoresInput)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetUpdateCameraYawIgnoresInput>(new_updateCameraYawIgnoresInput))
+            return;
         m_updateCameraYawIgnoresInput = new_updateCameraYawIgnoresInput;
     }
     bool FirstPersonControllerComponent::GetUpdateCameraPitchIgnoresInput() const
@@ -3504,35 +5484,576 @@ namespace FirstPersonController
     }
     void FirstPersonControllerComponent::SetUpdateCameraPitchIgnoresInput(const bool& new_updateCameraPitchIgnoresInput)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::SetUpdateCameraPitchIgnoresInput>(new_updateCameraPitchIgnoresInput))
+            return;
         m_updateCameraPitchIgnoresInput = new_updateCameraPitchIgnoresInput;
     }
     void FirstPersonControllerComponent::UpdateCameraYaw(const float& new_cameraYawAngle)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::UpdateCameraYaw>(new_cameraYawAngle))
+            return;
         if(m_updateCameraYawIgnoresInput)
-            m_cameraRotationAngles[2] = new_cameraYawAngle;
+            m_hot.m_cameraRotationAngles[2] = new_cameraYawAngle;
         else
-            m_cameraRotationAngles[2] = new_cameraYawAngle - m_yawValue * m_yawSensitivity;
-        m_rotatingYawViaScriptGamepad = true;
+            m_hot.m_cameraRotationAngles[2] = new_cameraYawAngle - m_yawValue * m_yawSensitivity;
+        m_hot.m_rotatingYawViaScriptGamepad = true;
     }
     void FirstPersonControllerComponent::UpdateCameraPitch(const float& new_cameraPitchAngle)
     {
+        if(QueueSetter<&FirstPersonControllerComponent::UpdateCameraPitch>(new_cameraPitchAngle))
+            return;
         if(m_updateCameraPitchIgnoresInput)
-            m_cameraRotationAngles[0] = new_cameraPitchAngle;
+            m_hot.m_cameraRotationAngles[0] = new_cameraPitchAngle;
         else
-            m_cameraRotationAngles[0] = new_cameraPitchAngle - m_pitchValue * m_pitchSensitivity;
-        m_rotatingPitchViaScriptGamepad = true;
+            m_hot.m_cameraRotationAngles[0] = new_cameraPitchAngle - m_pitchValue * m_pitchSensitivity;
+        m_hot.m_rotatingPitchViaScriptGamepad = true;
     }
     float FirstPersonControllerComponent::GetHeading() const
     {
-        return m_currentHeading;
+        return m_hot.m_currentHeading;
     }
     void FirstPersonControllerComponent::SetHeadingForTick(const float& new_currentHeading)
     {
-        m_currentHeading = new_currentHeading;
-        m_scriptSetcurrentHeadingTick = true;
+        if(QueueSetter<&FirstPersonControllerComponent::SetHeadingForTick>(new_currentHeading))
+            return;
+        m_hot.m_currentHeading = new_currentHeading;
+        m_hot.m_scriptSetcurrentHeadingTick = true;
     }
     float FirstPersonControllerComponent::GetPitch() const
     {
-        return m_currentPitch;
+        return m_hot.m_currentPitch;
+    }
+    FirstPersonControllerState FirstPersonControllerComponent::GetStateSnapshot() const
+    {
+        return m_publishedState.Read();
+    }
+    AZStd::string FirstPersonControllerComponent::GetMovementProfileName() const
+    {
+        return m_movementProfileName;
+    }
+    void FirstPersonControllerComponent::SetMovementProfileName(const AZStd::string& new_movementProfileName)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::SetMovementProfileName>(new_movementProfileName))
+            return;
+        m_movementProfileName = new_movementProfileName;
+        ResolveMovementProfile();
+    }
+    void FirstPersonControllerComponent::ReapplyMovementProfile()
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::ReapplyMovementProfile>())
+            return;
+        ApplyMovementProfile();
+    }
+    void FirstPersonControllerComponent::ApplyMovementProfile()
+    {
+        if(m_sharedMovementProfile == nullptr)
+            return;
+
+        // Store the stamina regenerated so far under the outgoing sprint parameters, as the stamina setters do
+        if(m_movementProfile != nullptr)
+            FoldSprintHeldDuration();
+
+        if(m_movementProfileOverrides == nullptr)
+        {
+            m_movementProfile = m_sharedMovementProfile.get();
+        }
+        else
+        {
+            // Take the shared profile's values for every field that was not overridden on this controller
+            FirstPersonControllerMovementProfile merged = *m_sharedMovementProfile;
+            auto keepOverride = [this, &merged](MovementProfileField field, auto member)
+            {
+                if(IsMovementProfileOverridden(field))
+                    merged.*member = (*m_movementProfileOverrides).*member;
+            };
+            keepOverride(MovementProfileField::ForwardEventName, &FirstPersonControllerMovementProfile::m_forwardEventName);
+            keepOverride(MovementProfileField::BackEventName, &FirstPersonControllerMovementProfile::m_backEventName);
+            keepOverride(MovementProfileField::LeftEventName, &FirstPersonControllerMovementProfile::m_leftEventName);
+            keepOverride(MovementProfileField::RightEventName, &FirstPersonControllerMovementProfile::m_rightEventName);
+            keepOverride(MovementProfileField::YawEventName, &FirstPersonControllerMovementProfile::m_yawEventName);
+            keepOverride(MovementProfileField::PitchEventName, &FirstPersonControllerMovementProfile::m_pitchEventName);
+            keepOverride(MovementProfileField::SprintEventName, &FirstPersonControllerMovementProfile::m_sprintEventName);
+            keepOverride(MovementProfileField::CrouchEventName, &FirstPersonControllerMovementProfile::m_crouchEventName);
+            keepOverride(MovementProfileField::JumpEventName, &FirstPersonControllerMovementProfile::m_jumpEventName);
+            keepOverride(MovementProfileField::GroundedCollisionGroup, &FirstPersonControllerMovementProfile::m_groundedCollisionGroup);
+            keepOverride(MovementProfileField::JumpHeadCollisionGroup, &FirstPersonControllerMovementProfile::m_jumpHeadCollisionGroup);
+            keepOverride(MovementProfileField::StandCollisionGroup, &FirstPersonControllerMovementProfile::m_standCollisionGroup);
+            keepOverride(MovementProfileField::TopWalkSpeed, &FirstPersonControllerMovementProfile::m_topWalkSpeed);
+            keepOverride(MovementProfileField::WalkAcceleration, &FirstPersonControllerMovementProfile::m_walkAcceleration);
+            keepOverride(MovementProfileField::Deceleration, &FirstPersonControllerMovementProfile::m_deceleration);
+            keepOverride(MovementProfileField::OpposingDeceleration, &FirstPersonControllerMovementProfile::m_opposingDeceleration);
+            keepOverride(MovementProfileField::ForwardScale, &FirstPersonControllerMovementProfile::m_forwardScale);
+            keepOverride(MovementProfileField::BackScale, &FirstPersonControllerMovementProfile::m_backScale);
+            keepOverride(MovementProfileField::LeftScale, &FirstPersonControllerMovementProfile::m_leftScale);
+            keepOverride(MovementProfileField::RightScale, &FirstPersonControllerMovementProfile::m_rightScale);
+            keepOverride(MovementProfileField::SprintScaleForward, &FirstPersonControllerMovementProfile::m_sprintScaleForward);
+            keepOverride(MovementProfileField::SprintScaleBack, &FirstPersonControllerMovementProfile::m_sprintScaleBack);
+            keepOverride(MovementProfileField::SprintScaleLeft, &FirstPersonControllerMovementProfile::m_sprintScaleLeft);
+            keepOverride(MovementProfileField::SprintScaleRight, &FirstPersonControllerMovementProfile::m_sprintScaleRight);
+            keepOverride(MovementProfileField::SprintAccelScale, &FirstPersonControllerMovementProfile::m_sprintAccelScale);
+            keepOverride(MovementProfileField::SprintMaxTime, &FirstPersonControllerMovementProfile::m_sprintMaxTime);
+            keepOverride(MovementProfileField::SprintCooldownTime, &FirstPersonControllerMovementProfile::m_sprintCooldownTime);
+            keepOverride(MovementProfileField::SprintRegenRate, &FirstPersonControllerMovementProfile::m_sprintRegenRate);
+            keepOverride(MovementProfileField::CrouchScale, &FirstPersonControllerMovementProfile::m_crouchScale);
+            keepOverride(MovementProfileField::CrouchDistance, &FirstPersonControllerMovementProfile::m_crouchDistance);
+            keepOverride(MovementProfileField::CrouchTime, &FirstPersonControllerMovementProfile::m_crouchTime);
+            keepOverride(MovementProfileField::StandTime, &FirstPersonControllerMovementProfile::m_standTime);
+            keepOverride(MovementProfileField::Gravity, &FirstPersonControllerMovementProfile::m_gravity);
+            keepOverride(MovementProfileField::JumpInitialVelocity, &FirstPersonControllerMovementProfile::m_jumpInitialVelocity);
+            keepOverride(MovementProfileField::JumpSecondInitialVelocity, &FirstPersonControllerMovementProfile::m_jumpSecondInitialVelocity);
+            keepOverride(MovementProfileField::JumpHeldGravityFactor, &FirstPersonControllerMovementProfile::m_jumpHeldGravityFactor);
+            keepOverride(MovementProfileField::JumpFallingGravityFactor, &FirstPersonControllerMovementProfile::m_jumpFallingGravityFactor);
+            keepOverride(MovementProfileField::JumpAccelFactor, &FirstPersonControllerMovementProfile::m_jumpAccelFactor);
+            keepOverride(MovementProfileField::JumpHoldDistance, &FirstPersonControllerMovementProfile::m_jumpHoldDistance);
+            *m_movementProfileOverrides = AZStd::move(merged);
+            m_movementProfile = m_movementProfileOverrides.get();
+        }
+
+        // Keep the values that are derived from the profile's fields consistent with them
+        ApplyMovementProfileCollisionGroups();
+        if(!IsMovementProfileOverridden(MovementProfileField::SprintPauseTime))
+            m_sprintPauseTime = (m_movementProfile->m_sprintCooldownTime > m_movementProfile->m_sprintMaxTime) ? 0.f : 0.1f * m_movementProfile->m_sprintCooldownTime;
+        UpdateDerivedConstants();
+        AssignConnectInputEvents();
+    }
+    void FirstPersonControllerComponent::ClearMovementProfileOverrides()
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::ClearMovementProfileOverrides>())
+            return;
+        m_movementProfileOverrides.reset();
+        m_movementProfileOverrideMask = 0;
+        ApplyMovementProfile();
+    }
+    FirstPersonControllerJumpPrediction FirstPersonControllerComponent::PredictJump(const float& holdDuration, const float& horizontalSpeed, const float& secondJumpDelay) const
+    {
+        FirstPersonControllerJumpPrediction prediction;
+        const VerticalMotionParams params{m_movementProfile->m_gravity, m_movementProfile->m_jumpHeldGravityFactor, m_movementProfile->m_jumpFallingGravityFactor};
+        if(m_movementProfile->m_gravity >= 0.f || m_movementProfile->m_jumpFallingGravityFactor <= 0.f)
+            return prediction;
+
+        const float holdTime = AZStd::clamp(holdDuration, 0.f, m_jumpMaxHoldTime);
+        PredictVerticalApex(m_movementProfile->m_jumpInitialVelocity, holdTime, params, prediction.m_timeToApex, prediction.m_apexHeight);
+        prediction.m_airTime = prediction.m_timeToApex + PredictVerticalFallTime(prediction.m_apexHeight, 0.f, params);
+
+        // The second jump launches from wherever the first jump is at the delay given, without a held phase.
+        // A negative delay or one past the landing of the first jump means that no second jump is made. The jump has
+        // to be released before the second jump can be made, so the delay is at least the time the first jump is held.
+        const float launchDelay = AZStd::max(secondJumpDelay, holdDuration);
+        if(m_doubleJumpEnabled && secondJumpDelay >= 0.f && launchDelay < prediction.m_airTime)
+        {
+            float velocityZ = m_movementProfile->m_jumpInitialVelocity;
+            const float launchHeight = IntegrateVerticalMotion(velocityZ, holdTime, launchDelay, params);
+
+            float secondTimeToApex = 0.f;
+            float secondApexHeight = 0.f;
+            PredictVerticalApex(m_movementProfile->m_jumpSecondInitialVelocity, 0.f, params, secondTimeToApex, secondApexHeight);
+
+            const float secondPeakHeight = launchHeight + secondApexHeight;
+            if(secondPeakHeight >= prediction.m_apexHeight || launchDelay < prediction.m_timeToApex)
+            {
+                prediction.m_apexHeight = AZStd::max(secondPeakHeight, launchHeight);
+                prediction.m_timeToApex = launchDelay + secondTimeToApex;
+            }
+            prediction.m_airTime = launchDelay + secondTimeToApex
+                + PredictVerticalFallTime(secondPeakHeight, AZStd::min(m_movementProfile->m_jumpSecondInitialVelocity, 0.f), params);
+        }
+
+        prediction.m_horizontalReach = horizontalSpeed * prediction.m_airTime;
+        prediction.m_valid = true;
+        return prediction;
+    }
+    bool FirstPersonControllerComponent::TestJumpArc(const AZ::Vector3& startPosition, const AZ::Vector3& horizontalVelocity, const float& holdDuration) const
+    {
+        const FirstPersonControllerJumpPrediction prediction = PredictJump(holdDuration, horizontalVelocity.GetLength(), -1.f);
+        if(!prediction.m_valid)
+            return false;
+
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+        if(sceneInterface == nullptr)
+            return false;
+        const AzPhysics::SceneHandle sceneHandle = sceneInterface->GetSceneHandle(AzPhysics::DefaultPhysicsSceneName);
+
+        // Approximate the arc with the chords from the take-off to the apex and from the apex to the landing,
+        // swept with a sphere of the capsule's radius centered halfway up the capsule
+        const AZ::Vector3 centerOffset = m_velocityZPosDirection * (0.5f * m_capsuleHeight);
+        const AZ::Vector3 points[3] = {
+            startPosition + centerOffset,
+            startPosition + centerOffset + horizontalVelocity * prediction.m_timeToApex + m_velocityZPosDirection * prediction.m_apexHeight,
+            startPosition + centerOffset + horizontalVelocity * prediction.m_airTime };
+
+        for(int i = 0; i < 2; ++i)
+        {
+            const AZ::Vector3 segment = points[i+1] - points[i];
+            const float distance = segment.GetLength();
+            if(distance == 0.f)
+                continue;
+
+            // Only static geometry is considered so that the character's own collider doesn't obstruct the arc
+            AzPhysics::ShapeCastRequest request = AzPhysics::ShapeCastRequestHelpers::CreateSphereCastRequest(
+                m_capsuleRadius,
+                AZ::Transform::CreateTranslation(points[i]),
+                segment / distance,
+                distance,
+                AzPhysics::SceneQuery::QueryType::Static,
+                m_groundedCollisionGroup,
+                nullptr);
+
+            if(sceneInterface->QueryScene(sceneHandle, &request))
+                return false;
+        }
+
+        return true;
+    }
+    AZ::u32 FirstPersonControllerComponent::AddPropertyThresholdWatch(const AZStd::string& propertyName, const float& threshold)
+    {
+        return AddPropertyWatch(propertyName, threshold, false);
+    }
+    AZ::u32 FirstPersonControllerComponent::AddPropertyDeltaWatch(const AZStd::string& propertyName, const float& delta)
+    {
+        if(delta <= 0.f)
+        {
+            AZ_Warning("First Person Controller Component", false, "A property delta watch needs a delta greater than zero.");
+            return 0;
+        }
+        return AddPropertyWatch(propertyName, delta, true);
+    }
+    void FirstPersonControllerComponent::RemovePropertyWatch(const AZ::u32& watchId)
+    {
+        WakeForRequest();
+        AZStd::erase_if(m_propertyWatches, [&watchId](const PropertyWatch& watch) { return watch.m_id == watchId; });
+    }
+    void FirstPersonControllerComponent::ClearPropertyWatches()
+    {
+        WakeForRequest();
+        m_propertyWatches.clear();
+    }
+    float FirstPersonControllerComponent::GetWatchedValue(const FirstPersonControllerState& state, WatchedProperty property)
+    {
+        switch(property)
+        {
+        case WatchedProperty::StaminaPercentage:
+            return state.m_staminaPercentage;
+        case WatchedProperty::CrouchedPercentage:
+            return state.m_crouchedPercentage;
+        case WatchedProperty::AirTime:
+            return state.m_airTime;
+        case WatchedProperty::Speed:
+            return state.m_prevTargetVelocityWorld.GetLength();
+        case WatchedProperty::SpeedXY:
+            return state.m_applyVelocityXY.GetLength();
+        case WatchedProperty::VelocityZ:
+            return state.m_applyVelocityZ;
+        case WatchedProperty::SprintCooldown:
+            return state.m_sprintCooldown;
+        case WatchedProperty::Heading:
+            return state.m_heading;
+        default:
+            return state.m_pitch;
+        }
+    }
+    // Returns the ID of the new watch, or 0 if the property name isn't recognized. The names match the
+    // FirstPersonControllerState properties.
+    AZ::u32 FirstPersonControllerComponent::AddPropertyWatch(const AZStd::string& propertyName, const float& threshold, const bool& deltaElseThreshold)
+    {
+        WakeForRequest();
+
+        static const AZStd::pair<const char*, WatchedProperty> propertyNames[] = {
+            {"Stamina Percentage", WatchedProperty::StaminaPercentage},
+            {"Crouched Percentage", WatchedProperty::CrouchedPercentage},
+            {"Air Time", WatchedProperty::AirTime},
+            {"Speed", WatchedProperty::Speed},
+            {"Apply Velocity XY Speed", WatchedProperty::SpeedXY},
+            {"Apply Velocity Z", WatchedProperty::VelocityZ},
+            {"Sprint Cooldown", WatchedProperty::SprintCooldown},
+            {"Heading", WatchedProperty::Heading},
+            {"Pitch", WatchedProperty::Pitch}};
+
+        for(const auto& [name, property]: propertyNames)
+        {
+            if(propertyName != name)
+                continue;
+
+            PropertyWatch watch;
+            watch.m_id = m_nextPropertyWatchId++;
+            watch.m_property = property;
+            watch.m_deltaElseThreshold = deltaElseThreshold;
+            watch.m_threshold = threshold;
+            watch.m_lastValue = GetWatchedValue(m_publishedState.Read(), property);
+            m_propertyWatches.push_back(watch);
+            return watch.m_id;
+        }
+
+        AZ_Warning("First Person Controller Component", false, "\"%s\" is not a property that can be watched.", propertyName.c_str());
+        return 0;
+    }
+    void FirstPersonControllerComponent::EvaluatePropertyWatches()
+    {
+        const FirstPersonControllerState state = m_publishedState.Read();
+
+        // Triggered watches are collected first since a handler may add or remove watches
+        AZStd::vector<AZStd::pair<AZ::u32, float>> triggered;
+        for(PropertyWatch& watch: m_propertyWatches)
+        {
+            const float value = GetWatchedValue(state, watch.m_property);
+            bool trigger = false;
+            if(watch.m_deltaElseThreshold)
+                trigger = abs(value - watch.m_lastValue) >= watch.m_threshold;
+            else
+                trigger = (watch.m_lastValue < watch.m_threshold) != (value < watch.m_threshold);
+
+            if(!watch.m_deltaElseThreshold || trigger)
+                watch.m_lastValue = value;
+
+            if(trigger)
+                triggered.push_back({watch.m_id, value});
+        }
+
+        for(const auto& [watchId, value]: triggered)
+            FirstPersonControllerNotificationBus::Event(GetEntityId(), &FirstPersonControllerNotificationBus::Events::OnPropertyWatchTriggered, watchId, value);
+    }
+    // Moves the character along a world heading in radians at a speed in m/s for a duration in seconds
+    void FirstPersonControllerComponent::QueueMoveCommand(const float& heading, const float& speed, const float& duration)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::QueueMoveCommand>(heading, speed, duration))
+            return;
+        MoveCommand command;
+        command.m_heading = heading;
+        command.m_speed = speed;
+        command.m_duration = duration;
+        m_moveCommands.push_back(command);
+    }
+    // Turns the character to face a world heading in radians, turning by at most maxTurnRate radians per second
+    void FirstPersonControllerComponent::QueueFaceCommand(const float& heading, const float& maxTurnRate)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::QueueFaceCommand>(heading, maxTurnRate))
+            return;
+        FaceCommand command;
+        command.m_heading = heading;
+        command.m_maxTurnRate = maxTurnRate;
+        m_faceCommands.push_back(command);
+    }
+    // Jumps after a delay in seconds, holding the jump for holdDuration
+    void FirstPersonControllerComponent::QueueJumpCommand(const float& delay, const float& holdDuration)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::QueueJumpCommand>(delay, holdDuration))
+            return;
+        ActionCommand command;
+        command.m_jumpDelay = delay;
+        command.m_jumpHoldDuration = holdDuration;
+        command.m_jumpElseCrouch = true;
+        m_actionCommands.push_back(command);
+    }
+    // Crouches for a duration in seconds, or when the duration isn't positive then until the queued moves have finished
+    void FirstPersonControllerComponent::QueueCrouchCommand(const float& duration)
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::QueueCrouchCommand>(duration))
+            return;
+        ActionCommand command;
+        command.m_crouchDuration = duration;
+        m_actionCommands.push_back(command);
+    }
+    void FirstPersonControllerComponent::ClearMovementCommands()
+    {
+        if(QueueSetter<&FirstPersonControllerComponent::ClearMovementCommands>())
+            return;
+        if(m_moveCommandsActive)
+            EndMoveCommands();
+        if(!m_actionCommands.empty())
+        {
+            if(m_actionCommands.front().m_jumpElseCrouch)
+                m_jumpValue = 0.f;
+            else
+                m_crouchValue = 0.f;
+        }
+        m_moveCommands.clear();
+        m_faceCommands.clear();
+        m_actionCommands.clear();
+    }
+    AZ::u32 FirstPersonControllerComponent::GetMovementCommandCount() const
+    {
+        return static_cast<AZ::u32>(m_moveCommands.size() + m_faceCommands.size() + m_actionCommands.size());
+    }
+    void FirstPersonControllerComponent::EndMoveCommands()
+    {
+        m_scriptTargetVelocityXY = AZ::Vector2::CreateZero();
+        m_scriptSetsTargetVelocityXY = m_moveCommandsPrevScriptSetsTargetVelocityXY;
+        m_moveCommandsActive = false;
+    }
+    void FirstPersonControllerComponent::RunMovementCommands(const float& deltaTime)
+    {
+        // Moves drive the script target velocity, which is relative to the character's heading
+        if(!m_moveCommands.empty())
+        {
+            if(!m_moveCommandsActive)
+            {
+                m_moveCommandsPrevScriptSetsTargetVelocityXY = m_scriptSetsTargetVelocityXY;
+                m_moveCommandsActive = true;
+            }
+            m_scriptSetsTargetVelocityXY = true;
+
+            MoveCommand& move = m_moveCommands.front();
+            const float relativeHeading = move.m_heading - m_hot.m_currentHeading;
+            m_scriptTargetVelocityXY = AZ::Vector2(-sin(relativeHeading), cos(relativeHeading)) * move.m_speed;
+
+            move.m_elapsed += deltaTime;
+            if(move.m_elapsed >= move.m_duration)
+            {
+                m_moveCommands.pop_front();
+                if(m_moveCommands.empty())
+                    EndMoveCommands();
+            }
+        }
+
+        // Facing turns through the same path as script and gamepad yaw
+        if(!m_faceCommands.empty())
+        {
+            const FaceCommand& face = m_faceCommands.front();
+            float headingDifference = fmod(face.m_heading - m_hot.m_currentHeading, AZ::Constants::TwoPi);
+            if(headingDifference > AZ::Constants::Pi)
+                headingDifference -= AZ::Constants::TwoPi;
+            else if(headingDifference < -AZ::Constants::Pi)
+                headingDifference += AZ::Constants::TwoPi;
+
+            if(abs(headingDifference) <= m_headingCloseTolerance)
+                m_faceCommands.pop_front();
+            else
+            {
+                const float maxTurn = face.m_maxTurnRate * deltaTime;
+                m_hot.m_cameraRotationAngles[2] = AZ::GetClamp(headingDifference, -maxTurn, maxTurn);
+                m_hot.m_rotatingYawViaScriptGamepad = true;
+            }
+        }
+
+        // Jumps and crouches act like holding their inputs
+        if(!m_actionCommands.empty())
+        {
+            ActionCommand& action = m_actionCommands.front();
+            action.m_elapsed += deltaTime;
+            if(action.m_jumpElseCrouch)
+            {
+                const bool holding = action.m_elapsed >= action.m_jumpDelay;
+                const bool finished = action.m_elapsed >= action.m_jumpDelay + action.m_jumpHoldDuration + deltaTime;
+                m_jumpValue = (holding && !finished) ? 1.f : 0.f;
+                if(finished)
+                    m_actionCommands.pop_front();
+            }
+            else
+            {
+                const bool finished = (action.m_crouchDuration > 0.f) ? action.m_elapsed >= action.m_crouchDuration : m_moveCommands.empty();
+                m_crouchValue = finished ? 0.f : 1.f;
+                if(finished)
+                    m_actionCommands.pop_front();
+            }
+        }
+
+        if(m_moveCommands.empty() && m_faceCommands.empty() && m_actionCommands.empty())
+            FirstPersonControllerNotificationBus::Event(GetEntityId(), &FirstPersonControllerNotificationBus::Events::OnMovementCommandsCompleted);
+    }
+    void FirstPersonControllerComponent::ResolveMovementProfile()
+    {
+        m_sharedMovementProfile.reset();
+        auto* firstPersonControllerInterface = FirstPersonControllerInterface::Get();
+
+        if(firstPersonControllerInterface != nullptr && !m_movementProfileName.empty())
+        {
+            m_sharedMovementProfile = firstPersonControllerInterface->GetMovementProfile(m_movementProfileName);
+            AZ_Warning("First Person Controller Component", m_sharedMovementProfile != nullptr,
+                "Movement profile \"%s\" was not found, using this controller's own values.", m_movementProfileName.c_str());
+        }
+
+        // Without a named profile, controllers authored with the same values share one interned copy of them
+        if(m_sharedMovementProfile == nullptr)
+        {
+            if(firstPersonControllerInterface != nullptr)
+                m_sharedMovementProfile = firstPersonControllerInterface->InternMovementProfile(GetAuthoredMovementProfile());
+            else
+                m_sharedMovementProfile = AZStd::make_shared<const FirstPersonControllerMovementProfile>(GetAuthoredMovementProfile());
+        }
+
+        ApplyMovementProfile();
+    }
+    FirstPersonControllerMovementProfile FirstPersonControllerComponent::GetAuthoredMovementProfile() const
+    {
+        FirstPersonControllerMovementProfile profile;
+        profile.m_forwardEventName = m_strForward;
+        profile.m_backEventName = m_strBack;
+        profile.m_leftEventName = m_strLeft;
+        profile.m_rightEventName = m_strRight;
+        profile.m_yawEventName = m_strYaw;
+        profile.m_pitchEventName = m_strPitch;
+        profile.m_sprintEventName = m_strSprint;
+        profile.m_crouchEventName = m_strCrouch;
+        profile.m_jumpEventName = m_strJump;
+        // The component's collision groups are authored by Id and are kept by leaving the profile's group names empty
+        profile.m_topWalkSpeed = m_speed;
+        profile.m_walkAcceleration = m_accel;
+        profile.m_deceleration = m_decel;
+        profile.m_opposingDeceleration = m_opposingDecel;
+        profile.m_forwardScale = m_forwardScale;
+        profile.m_backScale = m_backScale;
+        profile.m_leftScale = m_leftScale;
+        profile.m_rightScale = m_rightScale;
+        profile.m_sprintScaleForward = m_sprintScaleForward;
+        profile.m_sprintScaleBack = m_sprintScaleBack;
+        profile.m_sprintScaleLeft = m_sprintScaleLeft;
+        profile.m_sprintScaleRight = m_sprintScaleRight;
+        profile.m_sprintAccelScale = m_sprintAccelScale;
+        profile.m_sprintMaxTime = m_sprintMaxTime;
+        profile.m_sprintCooldownTime = m_sprintCooldownTime;
+        profile.m_sprintRegenRate = m_sprintRegenRate;
+        profile.m_crouchScale = m_crouchScale;
+        profile.m_crouchDistance = m_crouchDistance;
+        profile.m_crouchTime = m_crouchTime;
+        profile.m_standTime = m_standTime;
+        profile.m_gravity = m_gravity;
+        profile.m_jumpInitialVelocity = m_jumpInitialVelocity;
+        profile.m_jumpSecondInitialVelocity = m_jumpSecondInitialVelocity;
+        profile.m_jumpHeldGravityFactor = m_jumpHeldGravityFactor;
+        profile.m_jumpFallingGravityFactor = m_jumpFallingGravityFactor;
+        profile.m_jumpAccelFactor = m_jumpAccelFactor;
+        profile.m_jumpHoldDistance = m_jumpHoldDistance;
+        return profile;
+    }
+    FirstPersonControllerMovementProfile& FirstPersonControllerComponent::OverrideMovementProfile(MovementProfileField field)
+    {
+        // The first override gives this controller its own copy of the profile, the shared one is never written to
+        if(m_movementProfileOverrides == nullptr)
+        {
+            m_movementProfileOverrides = AZStd::make_unique<FirstPersonControllerMovementProfile>(
+                (m_movementProfile != nullptr) ? *m_movementProfile : GetAuthoredMovementProfile());
+            m_movementProfile = m_movementProfileOverrides.get();
+        }
+        MarkMovementProfileOverride(field);
+        return *m_movementProfileOverrides;
+    }
+    void FirstPersonControllerComponent::MarkMovementProfileOverride(MovementProfileField field)
+    {
+        m_movementProfileOverrideMask |= AZ::u64(1) << static_cast<AZ::u8>(field);
+    }
+    bool FirstPersonControllerComponent::IsMovementProfileOverridden(MovementProfileField field) const
+    {
+        return (m_movementProfileOverrideMask & (AZ::u64(1) << static_cast<AZ::u8>(field))) != 0;
+    }
+    void FirstPersonControllerComponent::ApplyMovementProfileCollisionGroups()
+    {
+        // An empty group name keeps the group that is set on the component
+        auto applyGroup = [](const AZStd::string& groupName, AzPhysics::CollisionGroup& group, AzPhysics::CollisionGroups::Id& groupId)
+        {
+            if(groupName.empty())
+                return;
+            bool success = false;
+            AzPhysics::CollisionGroup collisionGroup;
+            Physics::CollisionRequestBus::BroadcastResult(success, &Physics::CollisionRequests::TryGetCollisionGroupByName, groupName, collisionGroup);
+            AZ_Warning("First Person Controller Component", success, "Collision group \"%s\" was not found.", groupName.c_str());
+            if(success)
+            {
+                group = collisionGroup;
+                const AzPhysics::CollisionConfiguration& configuration = AZ::Interface<AzPhysics::SystemInterface>::Get()->GetConfiguration()->m_collisionConfig;
+                groupId = configuration.m_collisionGroups.FindGroupIdByName(groupName);
+            }
+        };
+        applyGroup(m_movementProfile->m_groundedCollisionGroup, m_groundedCollisionGroup, m_groundedCollisionGroupId);
+        applyGroup(m_movementProfile->m_jumpHeadCollisionGroup, m_headCollisionGroup, m_headCollisionGroupId);
+        applyGroup(m_movementProfile->m_standCollisionGroup, m_standCollisionGroup, m_standCollisionGroupId);
     }
 }
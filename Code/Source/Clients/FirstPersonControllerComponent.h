@@ -3,13 +3,19 @@
  * You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #pragma once
+#include <FirstPersonController/FirstPersonControllerBus.h>
 #include <FirstPersonController/FirstPersonControllerComponentBus.h>
+#include <FirstPersonController/FirstPersonControllerMovementProfile.h>
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Quaternion.h>
+#include <AzCore/std/containers/deque.h>
 #include <AzCore/std/containers/map.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <Clients/FirstPersonControllerCommandQueue.h>
 
 #include <AzFramework/Physics/Common/PhysicsSceneQueries.h>
 #include <AzFramework/Physics/CharacterBus.h>
@@ -56,6 +62,31 @@ namespace FirstPersonController
         // Gamepad Events
         void OnGamepadEvent(const AzFramework::InputChannel& inputChannel);
 
+        // Input events are captured as timestamped commands. With Queue Input enabled they are pushed into a ring that the
+        // next step consumes, otherwise they are applied as soon as they arrive.
+        enum class InputCommandType : AZ::u8
+        {
+            Pressed,
+            Released,
+            Held,
+            Gamepad
+        };
+        struct InputCommand
+        {
+            AZ::u64 m_timestamp = 0;
+            StartingPointInput::InputEventNotificationId m_inputId;
+            AZ::Crc32 m_gamepadChannel;
+            float m_value = 0.f;
+            InputCommandType m_type = InputCommandType::Pressed;
+        };
+        void SubmitInputCommand(const InputCommand& command);
+        void ApplyInputCommand(const InputCommand& command);
+        void ConsumeInputCommands();
+        SpscCommandRing<InputCommand, 256> m_inputCommands;
+        // Claimed by the step that consumes the ring, since both the tick and the physics simulation can run a step
+        AZStd::atomic<bool> m_inputCommandsConsuming = false;
+        bool m_queueInput = false;
+
         // TickBus interface
         void OnTick(float deltaTime, AZ::ScriptTimePoint) override;
 
@@ -113,6 +144,12 @@ namespace FirstPersonController
         void SetGroundedForTick(const bool& new_grounded) override;
         AZStd::vector<AzPhysics::SceneQueryHit> GetGroundSceneQueryHits() const override;
         AZStd::vector<AzPhysics::SceneQueryHit> GetGroundCloseSceneQueryHits() const override;
+        AZStd::span<const AzPhysics::SceneQueryHit> GetGroundSceneQueryHitsView() const override;
+        AZStd::span<const AzPhysics::SceneQueryHit> GetGroundCloseSceneQueryHitsView() const override;
+        AZ::u32 GetGroundSceneQueryHitCount() const override;
+        AzPhysics::SceneQueryHit GetGroundSceneQueryHitByIndex(const AZ::u32& index) const override;
+        AZ::u32 GetGroundCloseSceneQueryHitCount() const override;
+        AzPhysics::SceneQueryHit GetGroundCloseSceneQueryHitByIndex(const AZ::u32& index) const override;
         AZ::Vector3 GetGroundSumNormalsDirection() const override;
         AZ::Vector3 GetGroundCloseSumNormalsDirection() const override;
         AzPhysics::SceneQuery::ResultFlags GetSceneQueryHitResultFlags(AzPhysics::SceneQueryHit hit) const override;
@@ -162,6 +199,47 @@ namespace FirstPersonController
         void SetAddVelocityForTimestepVsTick(const bool& new_addVelocityForTimestepVsTick) override;
         float GetPhysicsTimestepScaleFactor() const override;
         void SetPhysicsTimestepScaleFactor(const float& new_physicsTimestepScaleFactor) override;
+        bool GetFixedStepTick() const override;
+        void SetFixedStepTick(const bool& new_fixedStepTick) override;
+        float GetFixedStepRate() const override;
+        void SetFixedStepRate(const float& new_fixedStepRate) override;
+        AZ::u32 GetFixedStepMaxSubsteps() const override;
+        void SetFixedStepMaxSubsteps(const AZ::u32& new_fixedStepMaxSubsteps) override;
+        bool GetGroundQueriesOncePerFrame() const override;
+        void SetGroundQueriesOncePerFrame(const bool& new_groundQueriesOncePerFrame) override;
+        bool GetHeadQueryOncePerFrame() const override;
+        void SetHeadQueryOncePerFrame(const bool& new_headQueryOncePerFrame) override;
+        bool GetStandQueryOncePerFrame() const override;
+        void SetStandQueryOncePerFrame(const bool& new_standQueryOncePerFrame) override;
+        bool GetQueueSetters() const override;
+        void SetQueueSetters(const bool& new_queueSetters) override;
+        bool GetQueueInput() const override;
+        void SetQueueInput(const bool& new_queueInput) override;
+        bool GetDeferNotifications() const override;
+        void SetDeferNotifications(const bool& new_deferNotifications) override;
+        bool GetNotificationsEdgeTriggered() const override;
+        void SetNotificationsEdgeTriggered(const bool& new_notificationsEdgeTriggered) override;
+        float GetNotificationMinInterval() const override;
+        void SetNotificationMinInterval(const float& new_notificationMinInterval) override;
+        bool GetSleepWhenIdle() const override;
+        void SetSleepWhenIdle(const bool& new_sleepWhenIdle) override;
+        float GetSleepIdleDelay() const override;
+        void SetSleepIdleDelay(const float& new_sleepIdleDelay) override;
+        bool GetSleeping() const override;
+        void WakeUp() override;
+        AZ::u32 GetUpdateTier() const override;
+        void SetUpdateTier(const AZ::u32& new_updateTier, const AZ::u32& new_updateTierPhase) override;
+        bool GetCrowdSeparation() const override;
+        void SetCrowdSeparation(const bool& new_crowdSeparation) override;
+        float GetSeparationRadius() const override;
+        void SetSeparationRadius(const float& new_separationRadius) override;
+        float GetSeparationSpeed() const override;
+        void SetSeparationSpeed(const float& new_separationSpeed) override;
+        AZ::Vector2 GetSeparationVelocityXY() const override;
+        void ResetRuntimeState() override;
+        void Teleport(const AZ::Vector3& new_position, const float& new_heading) override;
+        bool GetPooled() const override;
+        void SetPooled(const bool& new_pooled) override;
         bool GetScriptSetsTargetVelocityXY() const override;
         void SetScriptSetsTargetVelocityXY(const bool& new_scriptSetsTargetVelocityXY) override;
         AZ::Vector2 GetTargetVelocityXY() const override;
@@ -192,8 +270,15 @@ namespace FirstPersonController
         void SetGroundedOffset(const float& new_groundedSphereCastOffset) override;
         float GetGroundCloseOffset() const override;
         void SetGroundCloseOffset(const float& new_groundCloseSphereCastOffset) override;
+        bool GetGroundCloseTimeToImpact() const override;
+        void SetGroundCloseTimeToImpact(const bool& new_groundCloseTimeToImpact) override;
+        float GetGroundCloseTimeThreshold() const override;
+        void SetGroundCloseTimeThreshold(const float& new_groundCloseTimeThreshold) override;
+        float GetTimeToGroundImpact() const override;
         float GetJumpHoldDistance() const override;
         void SetJumpHoldDistance(const float& new_jumpHoldDistance) override;
+        bool GetExactVelocityZ() const override;
+        void SetExactVelocityZ(const bool& new_exactVelocityZ) override;
         float GetJumpHeadSphereCastOffset() const override;
         void SetJumpHeadSphereCastOffset(const float& new_jumpHeadSphereCastOffset) override;
         bool GetHeadHitSetsApogee() const override;
@@ -205,6 +290,9 @@ namespace FirstPersonController
         AZStd::string GetHeadCollisionGroupName() const override;
         void SetHeadCollisionGroupByName(const AZStd::string& new_headCollisionGroupName) override;
         AZStd::vector<AZ::EntityId> GetHeadHitEntityIds() const override;
+        AZStd::span<const AZ::EntityId> GetHeadHitEntityIdsView() const override;
+        AZ::u32 GetHeadHitEntityIdCount() const override;
+        AZ::EntityId GetHeadHitEntityIdByIndex(const AZ::u32& index) const override;
         bool GetStandPrevented() const override;
         void SetStandPrevented(const bool& new_standPrevented) override;
         bool GetStandIgnoreDynamicRigidBodies() const override;
@@ -212,6 +300,9 @@ namespace FirstPersonController
         AZStd::string GetStandCollisionGroupName() const override;
         void SetStandCollisionGroupByName(const AZStd::string& new_standCollisionGroupName) override;
         AZStd::vector<AZ::EntityId> GetStandPreventedEntityIds() const override;
+        AZStd::span<const AZ::EntityId> GetStandPreventedEntityIdsView() const override;
+        AZ::u32 GetStandPreventedEntityIdCount() const override;
+        AZ::EntityId GetStandPreventedEntityIdByIndex(const AZ::u32& index) const override;
         float GetGroundSphereCastsRadiusPercentageIncrease() const override;
         void SetGroundSphereCastsRadiusPercentageIncrease(const float& new_groundSphereCastsRadiusPercentageIncrease) override;
         float GetMaxGroundedAngleDegrees() const override;
@@ -233,6 +324,8 @@ namespace FirstPersonController
         bool GetOpposingDecelFactorApplied() const override;
         bool GetInstantVelocityRotation() const override;
         void SetInstantVelocityRotation(const bool& new_instantVelocityRotation) override;
+        bool GetAnalyticVelocityXY() const override;
+        void SetAnalyticVelocityXY(const bool& new_analyticVelocityXY) override;
         bool GetVelocityXYIgnoresObstacles() const override;
         void SetVelocityXYIgnoresObstacles(const bool& new_velocityXYIgnoresObstacles) override;
         bool GetGravityIgnoresObstacles() const override;
@@ -338,6 +431,23 @@ namespace FirstPersonController
         float GetHeading() const override;
         void SetHeadingForTick(const float& new_currentHeading) override;
         float GetPitch() const override;
+        FirstPersonControllerState GetStateSnapshot() const override;
+        AZStd::string GetMovementProfileName() const override;
+        void SetMovementProfileName(const AZStd::string& new_movementProfileName) override;
+        void ReapplyMovementProfile() override;
+        void ClearMovementProfileOverrides() override;
+        FirstPersonControllerJumpPrediction PredictJump(const float& holdDuration, const float& horizontalSpeed, const float& secondJumpDelay) const override;
+        bool TestJumpArc(const AZ::Vector3& startPosition, const AZ::Vector3& horizontalVelocity, const float& holdDuration) const override;
+        AZ::u32 AddPropertyThresholdWatch(const AZStd::string& propertyName, const float& threshold) override;
+        AZ::u32 AddPropertyDeltaWatch(const AZStd::string& propertyName, const float& delta) override;
+        void RemovePropertyWatch(const AZ::u32& watchId) override;
+        void ClearPropertyWatches() override;
+        void QueueMoveCommand(const float& heading, const float& speed, const float& duration) override;
+        void QueueFaceCommand(const float& heading, const float& maxTurnRate) override;
+        void QueueJumpCommand(const float& delay, const float& holdDuration) override;
+        void QueueCrouchCommand(const float& duration) override;
+        void ClearMovementCommands() override;
+        AZ::u32 GetMovementCommandCount() const override;
 
     private:
         // Input event assignment and notification bus connection
@@ -352,18 +462,244 @@ namespace FirstPersonController
 
         // Called on each tick
         void ProcessInput(const float& deltaTime, const bool& tickElseTimestep);
+        void ProcessStep(const float& deltaTime, const bool& timestepElseTick);
+        void SimulateStep(const float& deltaTime);
+        void SubmitVelocity(const AZ::Vector3& velocity);
+        void FixedStepTick(const float& deltaTime);
 
         // Various methods used to implement the First Person Controller functionality
         void CheckGrounded(const float& deltaTime);
         void UpdateVelocityXY(const float& deltaTime);
         void UpdateJumpMaxHoldTime();
+        void UpdateDerivedConstants();
+        bool ExceedsMaxGroundedAngle(const AZ::Vector3& normal) const;
         void UpdateVelocityZ(const float& deltaTime);
         void UpdateRotation(const float& deltaTime);
         AZ::Vector2 LerpVelocityXY(const AZ::Vector2& targetVelocity, const float& deltaTime);
+        AZ::Vector2 AnalyticVelocityXY(const AZ::Vector2& targetVelocity, const float& deltaTime);
+        float ComputeLerpDeltaTime(const float& deltaTime) const;
+        float ComputeOpposingDecelerationFactor(const AZ::Vector2& targetVelocity) const;
+        void FinishVelocityXYStep(const AZ::Vector2& newVelocity, const AZ::Vector2& targetVelocity);
         void SmoothRotation(const float& deltaTime);
         void SprintManager(const AZ::Vector2& targetVelocity, const float& deltaTime);
         void CrouchManager(const float& deltaTime);
 
+        // Movement tuning read by the step. It points at the shared profile named by m_movementProfileName, or when no name
+        // is set at a shared profile interned from this component's own serialized values, which are only read to build it.
+        // Controllers of one archetype therefore step from a single copy. The serialized values stay on each instance, so this
+        // doesn't make a controller smaller. A controller only allocates its own copy once a field is changed through the
+        // request bus, and the overridden fields are kept when the shared profile is reapplied.
+        enum class MovementProfileField : AZ::u8
+        {
+            ForwardEventName,
+            BackEventName,
+            LeftEventName,
+            RightEventName,
+            YawEventName,
+            PitchEventName,
+            SprintEventName,
+            CrouchEventName,
+            JumpEventName,
+            GroundedCollisionGroup,
+            JumpHeadCollisionGroup,
+            StandCollisionGroup,
+            TopWalkSpeed,
+            WalkAcceleration,
+            Deceleration,
+            OpposingDeceleration,
+            ForwardScale,
+            BackScale,
+            LeftScale,
+            RightScale,
+            SprintScaleForward,
+            SprintScaleBack,
+            SprintScaleLeft,
+            SprintScaleRight,
+            SprintAccelScale,
+            SprintMaxTime,
+            SprintCooldownTime,
+            SprintRegenRate,
+            CrouchScale,
+            CrouchDistance,
+            CrouchTime,
+            StandTime,
+            Gravity,
+            JumpInitialVelocity,
+            JumpSecondInitialVelocity,
+            JumpHeldGravityFactor,
+            JumpFallingGravityFactor,
+            JumpAccelFactor,
+            JumpHoldDistance,
+            // Not a profile field, the pause time is derived from the profile unless it was set on this controller
+            SprintPauseTime,
+        };
+        void ResolveMovementProfile();
+        void ApplyMovementProfile();
+        FirstPersonControllerMovementProfile GetAuthoredMovementProfile() const;
+        FirstPersonControllerMovementProfile& OverrideMovementProfile(MovementProfileField field);
+        void MarkMovementProfileOverride(MovementProfileField field);
+        bool IsMovementProfileOverridden(MovementProfileField field) const;
+        void ApplyMovementProfileCollisionGroups();
+        AZStd::string m_movementProfileName;
+        const FirstPersonControllerMovementProfile* m_movementProfile = nullptr;
+        AZStd::shared_ptr<const FirstPersonControllerMovementProfile> m_sharedMovementProfile;
+        AZStd::unique_ptr<FirstPersonControllerMovementProfile> m_movementProfileOverrides;
+        AZ::u64 m_movementProfileOverrideMask = 0;
+
+        // Property watches, evaluated once per tick on the game thread against the published state snapshot.
+        // A threshold watch triggers whenever the value crosses the threshold in either direction, and a delta watch
+        // triggers whenever the value has moved by at least the delta since it last triggered.
+        enum class WatchedProperty : AZ::u8
+        {
+            StaminaPercentage,
+            CrouchedPercentage,
+            AirTime,
+            Speed,
+            SpeedXY,
+            VelocityZ,
+            SprintCooldown,
+            Heading,
+            Pitch
+        };
+        struct PropertyWatch
+        {
+            AZ::u32 m_id = 0;
+            WatchedProperty m_property = WatchedProperty::StaminaPercentage;
+            bool m_deltaElseThreshold = false;
+            float m_threshold = 0.f;
+            float m_lastValue = 0.f;
+        };
+        AZ::u32 AddPropertyWatch(const AZStd::string& propertyName, const float& threshold, const bool& deltaElseThreshold);
+        static float GetWatchedValue(const FirstPersonControllerState& state, WatchedProperty property);
+        void EvaluatePropertyWatches();
+        AZStd::vector<PropertyWatch> m_propertyWatches;
+        AZ::u32 m_nextPropertyWatchId = 1;
+
+        // High-level movement commands for AI-driven characters, advanced on each tick before the rotation is updated.
+        // Moves, facing and actions (jumping and crouching) are separate queues that run at the same time, each one
+        // working through its own commands in order.
+        struct MoveCommand
+        {
+            // World heading in radians, speed in m/s and duration in seconds
+            float m_heading = 0.f;
+            float m_speed = 0.f;
+            float m_duration = 0.f;
+            float m_elapsed = 0.f;
+        };
+        struct FaceCommand
+        {
+            // World heading in radians and the max turn rate in radians per second
+            float m_heading = 0.f;
+            float m_maxTurnRate = 0.f;
+        };
+        // Jumps and crouches share one queue so that they run in the order they were queued
+        struct ActionCommand
+        {
+            // Jump delay and hold duration in seconds
+            float m_jumpDelay = 0.f;
+            float m_jumpHoldDuration = 0.f;
+            // Crouch duration in seconds, until the queued moves have finished when it isn't positive
+            float m_crouchDuration = 0.f;
+            float m_elapsed = 0.f;
+            bool m_jumpElseCrouch = false;
+        };
+        void RunMovementCommands(const float& deltaTime);
+        void EndMoveCommands();
+        AZStd::deque<MoveCommand> m_moveCommands;
+        AZStd::deque<FaceCommand> m_faceCommands;
+        AZStd::deque<ActionCommand> m_actionCommands;
+        bool m_moveCommandsPrevScriptSetsTargetVelocityXY = false;
+        bool m_moveCommandsActive = false;
+        // Facing is complete once the heading is within this many radians of the target
+        float m_headingCloseTolerance = 0.01f;
+
+        // Per-step state snapshot, published at the end of ProcessInput() for readers on any thread
+        void UpdateStateSnapshot();
+        FirstPersonControllerPublishedState m_publishedState;
+
+        // Setters called from outside of this controller's step while Queue Setters is enabled are deferred to the
+        // start of the next step, so that a step running on another thread never sees its inputs change part way through.
+        // Every public request that changes state the step reads begins with QueueSetter(), including the ones that take
+        // several arguments or none. The exceptions are the requests that must act immediately to control the queuing or
+        // the stepping itself (Queue Setters, Queue Input, Pooled, Wake Up, and Add Velocity For Timestep Vs Tick, which
+        // reconnects the physics callback that runs the step), and the property watches, which are only read on the tick.
+        // A pooled controller doesn't step, so its setters apply immediately.
+        struct QueuedSetter
+        {
+            static constexpr size_t MaxValues = 4;
+            void (*m_apply)(FirstPersonControllerComponent&, const QueuedSetter&) = nullptr;
+            // Arguments packed in order, with one value for each float, bool or AZ::u32 and one for each vector component
+            float m_values[MaxValues] = {};
+            // Setters take at most one string argument
+            AZStd::string m_string;
+        };
+        // Wake is false for the Update Tier, which the system component's LOD pass sets on every controller and which
+        // only changes how often the character steps, not anything a sleeping character needs to respond to
+        template<auto Setter, bool Wake = true, typename... Args>
+        bool QueueSetter(const Args&... args);
+        // Wakes a sleeping character for a request made from outside of its step, called by QueueSetter() and by the
+        // requests that apply immediately
+        void WakeForRequest();
+        void ApplyQueuedSetters();
+        BoundedCommandQueue<QueuedSetter, 64> m_queuedSetters;
+        bool m_queueSetters = false;
+        // The controller whose step is running on the current thread, setters called from within it apply immediately
+        static thread_local const FirstPersonControllerComponent* s_steppingController;
+
+        // Notifications are either broadcast immediately or, with Defer Notifications enabled, recorded into a bitmask
+        // during the step and flushed once per tick on the game thread. The enumerators follow the bus declaration order.
+        enum class NotificationEvent : AZ::u8
+        {
+            GroundHit,
+            GroundSoonHit,
+            Ungrounded,
+            StartedFalling,
+            JumpApogeeReached,
+            StartedMoving,
+            TargetVelocityReached,
+            Stopped,
+            TopWalkSpeedReached,
+            TopSprintSpeedReached,
+            HeadHit,
+            HitSomething,
+            GravityPrevented,
+            Crouched,
+            StoodUp,
+            StandPrevented,
+            StartedCrouching,
+            StartedStanding,
+            FirstJump,
+            SecondJump,
+            StaminaCapped,
+            StaminaReachedZero,
+            SprintStarted,
+            CooldownStarted,
+            CooldownDone,
+            GroundHitWithImpact,
+            HeadHitWithImpact,
+            HitSomethingWithImpact,
+            StandPreventedWithImpact,
+            Count
+        };
+        static constexpr AZ::u32 FirstImpactNotification = static_cast<AZ::u32>(NotificationEvent::GroundHitWithImpact);
+        static_assert(static_cast<AZ::u32>(NotificationEvent::Count) <= 32, "Notification events must fit in the pending bitmask");
+        void Notify(NotificationEvent event);
+        // Deferred impacts keep the latest payload of each event until the flush
+        void NotifyImpact(NotificationEvent event, const FirstPersonControllerImpact& impact);
+        SeqLockedValue<FirstPersonControllerImpact> m_pendingImpacts[static_cast<AZ::u32>(NotificationEvent::Count) - FirstImpactNotification];
+        FirstPersonControllerImpact m_headImpact;
+        FirstPersonControllerImpact m_standPreventedImpact;
+        void FlushNotifications(const float& deltaTime);
+        bool m_deferNotifications = false;
+        bool m_notificationsEdgeTriggered = false;
+        float m_notificationMinInterval = 0.f;
+        AZStd::atomic<AZ::u32> m_pendingNotifications = 0;
+        AZStd::atomic<AZ::u32> m_notificationStepCount = 0;
+        AZ::u32 m_notificationFlushedStepCount = 0;
+        AZ::u32 m_prevFlushedNotifications = 0;
+        float m_notificationClock = 0.f;
+        float m_notificationLastTimes[static_cast<AZ::u32>(NotificationEvent::Count)] = {};
+
         // FirstPersonControllerNotificationBus
         void OnGroundHit();
         void OnGroundSoonHit();
@@ -398,79 +734,224 @@ namespace FirstPersonController
         bool m_addVelocityForTimestepVsTick = true;
         float m_physicsTimestepScaleFactor = 1.f;
 
+        // Sleep mode, an idle character grounded on a static body skips its per-step work until it's woken by input,
+        // a setter, a movement command, WakeUp(), or its ground or itself being moved
+        bool IsIdle() const;
+        void UpdateSleep(const float& deltaTime);
+        bool CheckSleepDisturbed() const;
+
+        // Closed-form evaluation of the timers kept on m_hot.m_timerClock
+        bool StaminaRegenerates() const;
+        float GetStaminaRegenRate() const;
+        float GetSprintHeldDurationAt(const double& time) const;
+        double GetStaminaCappedTime() const;
+        double GetNextTimerEventTime() const;
+        void FoldSprintHeldDuration();
+
+        bool m_sleepWhenIdle = false;
+        float m_sleepIdleDelay = 1.f;
+        float m_sleepIdleTime = 0.f;
+        AZStd::atomic<bool> m_sleeping = false;
+        AZ::EntityId m_sleepGroundEntityId;
+        AZ::Vector3 m_sleepGroundPosition = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_sleepPosition = AZ::Vector3::CreateZero();
+
+        // Update tier assigned by the system component from the distance to the viewers. Tier 0 runs every step,
+        // tiers 1 and 2 run every 2nd and 4th step, and tier 3 only keeps the character on the ground every 4th step.
+        // The phase spreads the controllers of a tier across steps, and the time of the skipped steps is passed to
+        // the next step that runs.
+        void GroundSnapStep(const float& deltaTime, const bool& timestepElseTick);
+        AZ::u32 m_updateTier = 0;
+        AZ::u32 m_updateTierPhase = 0;
+        AZ::u32 m_updateTierStepCounter[2] = {0, 0};
+        float m_updateTierSkippedTime[2] = {0.f, 0.f};
+
+        // Crowd separation, steers away from nearby controllers found through the system component's spatial hash
+        // so that crowds spread out before their character controllers collide
+        static constexpr AZ::u32 MaxSeparationNeighbors = 16;
+        void UpdateSeparation();
+        bool m_crowdSeparation = false;
+        float m_separationRadius = 1.f;
+        float m_separationSpeed = 1.5f;
+        AZ::Vector2 m_separationVelocityXY = AZ::Vector2::CreateZero();
+
+        // A pooled controller stays activated but skips its steps until the system component hands it out again
+        bool m_pooled = false;
+
+        // Fixed step accumulator used in tick mode
+        bool m_fixedStepTick = false;
+        float m_fixedStepRate = 60.f;
+        AZ::u32 m_fixedStepMaxSubsteps = 4;
+        float m_fixedStepAccumulator = 0.f;
+        AZ::Vector3 m_fixedStepPrevVelocity = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_fixedStepSubmittedVelocity = AZ::Vector3::CreateZero();
+
+        // Scene query policies for when several steps run on one frame, either as physics substeps or fixed steps.
+        // Each query records the frame it was last made on, and the frame counter is advanced on each tick.
+        bool m_groundQueriesOncePerFrame = false;
+        bool m_headQueryOncePerFrame = false;
+        bool m_standQueryOncePerFrame = false;
+        AZ::u64 m_frameCounter = 1;
+        AZ::u64 m_groundQueryFrame = 0;
+        AZ::u64 m_headQueryFrame = 0;
+        AZ::u64 m_standQueryFrame = 0;
+
+        // Runtime state that is read and written on every step, kept together in a compact block so that a step
+        // touches as few cache lines as possible. Flags are stored as bitfields. Configuration values stay as
+        // individual reflected members below so that they can be serialized and edited.
+        struct alignas(64) HotState
+        {
+            HotState();
+
+            // Velocity application
+            AZ::Vector3 m_prevTargetVelocity;
+            AZ::Vector3 m_prevPrevTargetVelocity;
+            AZ::Vector2 m_applyVelocityXY;
+            AZ::Vector2 m_prevTargetVelocityXY;
+            AZ::Vector2 m_prevApplyVelocityXY;
+            AZ::Vector2 m_correctedVelocityXY;
+            // Velocity at the end of the last step when using the analytic X&Y velocity model
+            AZ::Vector2 m_analyticVelocityXY;
+            float m_applyVelocityZ;
+            float m_applyVelocityZCurrentDelta;
+            float m_applyVelocityZPrevDelta;
+            float m_correctedVelocityZ;
+
+            // Used to track where we are along lerping the velocity between the two values
+            float m_lerpTime;
+            float m_totalLerpTime;
+            float m_decelerationFactor;
+
+            // Sprint and stamina
+            float m_sprintAccelValue;
+            float m_sprintPrevValue;
+            float m_sprintVelocityAdjust;
+            float m_sprintAccelAdjust;
+            float m_sprintAccumulatedAccel;
+            float m_sprintPrevVelocityLength;
+            // Held duration as of m_sprintHeldDurationTime, regeneration after that time is evaluated on demand
+            float m_sprintHeldDuration;
+
+            // Crouching
+            float m_crouchPrevValue;
+            float m_cameraLocalZTravelDistance;
+            float m_capsuleCurrentHeight;
+
+            // Simulated time since activation, advanced by each simulated step and by the time spent asleep. The sprint pause,
+            // cooldown, stamina regeneration and air time are kept as times on this clock and evaluated in closed form when read.
+            double m_timerClock;
+            double m_sprintHeldDurationTime;
+            double m_sprintPauseEnd;
+            double m_sprintCooldownEnd;
+            double m_airborneSince;
+
+            // Jumping and grounded
+            float m_jumpCounter;
+            // Predicted time until landing, zero when grounded and negative when no ground was found by the sweep
+            float m_timeToGroundImpact;
+
+            // Rotation, with the angles used to rotate the camera
+            float m_currentHeading;
+            float m_currentPitch;
+            float m_cameraRotationAngles[3];
+
+            // Flags
+            bool m_hitSomething : 1;
+            // Gravity needs to be prevented for two ticks in a row, the first tick is tracked separately
+            bool m_gravityPreventedFirstTick : 1;
+            bool m_gravityPrevented : 1;
+            bool m_staminaIncreasing : 1;
+            bool m_staminaDecreasing : 1;
+            bool m_sprintDraining : 1;
+            bool m_sprintCoolingDown : 1;
+            bool m_sprintStopAccelAdjustCaptured : 1;
+            bool m_crouching : 1;
+            bool m_crouched : 1;
+            bool m_standing : 1;
+            bool m_standPrevented : 1;
+            bool m_standPreventedViaScript : 1;
+            bool m_grounded : 1;
+            bool m_scriptGrounded : 1;
+            bool m_scriptSetGroundTick : 1;
+            bool m_groundClose : 1;
+            bool m_scriptGroundClose : 1;
+            bool m_scriptSetGroundCloseTick : 1;
+            bool m_jumpHeld : 1;
+            bool m_jumpReqRepress : 1;
+            bool m_secondJump : 1;
+            bool m_headHit : 1;
+            bool m_scriptSetcurrentHeadingTick : 1;
+            // Used when a script wants to update the camera angle via the Request Bus or a gamepad
+            bool m_rotatingPitchViaScriptGamepad : 1;
+            bool m_rotatingYawViaScriptGamepad : 1;
+            bool m_accelerating : 1;
+            bool m_decelerationFactorApplied : 1;
+            bool m_opposingDecelFactorApplied : 1;
+            // The analytic X&Y velocity model starts from the last applied velocity instead of m_analyticVelocityXY
+            bool m_analyticVelocityRestart : 1;
+        };
+        // Fields added to HotState should be justified against this budget of four cache lines
+        static_assert(sizeof(HotState) <= 4 * 64, "FirstPersonControllerComponent::HotState has grown past four cache lines");
+        HotState m_hot;
+
+        // Values derived from configuration, refreshed by UpdateDerivedConstants() from the setters of their inputs
+        // and from OnCharacterActivated() instead of being recomputed on every step
+        struct DerivedConstants
+        {
+            float m_greatestScale = 1.f;
+            float m_greatestWalkSpeed = 5.f;
+            float m_greatestCrouchSpeed = 2.5f;
+            float m_greatestSprintScale = 1.5f;
+            float m_greatestSprintScaleOrZero = 1.5f;
+            // Forward, back, left and right sprint scales multiplied by their direction scales
+            float m_sprintDirectionScales[4] = {1.5f, 0.75f, 1.25f, 1.25f};
+            float m_groundSphereCastsRadius = 1.415f * 0.3f;
+            float m_cosMaxGroundedAngle = 0.866025f;
+            float m_sphereCastsAxisLength = 1.f;
+            // The profile's crouch distance limited by the capsule's dimensions
+            float m_crouchDistance = 0.5f;
+        };
+        DerivedConstants m_derived;
+
         // Velocity application variables
-        AZ::Vector2 m_applyVelocityXY = AZ::Vector2::CreateZero();
-        AZ::Vector3 m_prevTargetVelocity = AZ::Vector3::CreateZero();
-        AZ::Vector3 m_prevPrevTargetVelocity = AZ::Vector3::CreateZero();
         AZ::Vector2 m_scriptTargetVelocityXY = AZ::Vector2::CreateZero();
         AZ::Vector3 m_addVelocityWorld = AZ::Vector3::CreateZero();
         AZ::Vector3 m_addVelocityHeading = AZ::Vector3::CreateZero();
-        AZ::Vector2 m_prevTargetVelocityXY = AZ::Vector2::CreateZero();
-        AZ::Vector2 m_prevApplyVelocityXY = AZ::Vector2::CreateZero();
-        AZ::Vector2 m_correctedVelocityXY = AZ::Vector2::CreateZero();
         float m_velocityCloseTolerance = 1.f;
         bool m_instantVelocityRotation = true;
+        bool m_analyticVelocityXY = false;
         bool m_velocityXYIgnoresObstacles = true;
         bool m_gravityIgnoresObstacles = false;
         bool m_posZIgnoresObstacles = true;
         bool m_jumpAllowedWhenGravityPrevented = true;
-        bool m_hitSomething = false;
-        bool m_gravityPrevented[2] = {false, false};
 
         // Determines whether the character's X&Y target velocity
         // will be set the request bus (script), in effect the entire time this variable is true
         bool m_scriptSetsTargetVelocityXY = false;
 
-        // Angles used to rotate the camera
-        float m_cameraRotationAngles[3] = {0.f, 0.f, 0.f};
-
         // Top walk speed
         float m_speed = 5.f;
 
-        // Used to track where we are along lerping the velocity between the two values
-        float m_lerpTime = 0.f;
-        float m_totalLerpTime = 0.f;
-
         // Sprint application variables
-        float m_sprintAccelValue = 1.f;
-        float m_sprintPrevValue = 1.f;
-        float m_sprintVelocityAdjust = 0.f;
         float m_sprintScaleForward = 1.5f;
         float m_sprintScaleBack = 1.f;
         float m_sprintScaleLeft = 1.25f;
         float m_sprintScaleRight = 1.25f;
-        float m_sprintAccelAdjust = 0.f;
-        bool m_sprintStopAccelAdjustCaptured = false;
-        float m_sprintAccumulatedAccel = 0.f;
-        float m_sprintPrevVelocityLength = 0.f;
-        float m_sprintHeldDuration = 0.f;
         float m_sprintRegenRate = 1.f;
         float m_sprintMaxTime = 120.f;
-        float m_sprintCooldown = 0.f;
         float m_sprintCooldownTime = 1.f;
         float m_sprintPauseTime = (m_sprintCooldownTime > m_sprintMaxTime) ? 0.f : 0.1f * m_sprintCooldownTime;
-        float m_sprintPause = 0.f;
         bool m_sprintBackwards = true;
         bool m_sprintWhileCrouched = true;
         bool m_sprintViaScript = false;
         bool m_sprintEnableDisableScript = false;
-        bool m_staminaIncreasing = false;
-        bool m_staminaDecreasing = false;
         bool m_sprintUsesStamina = true;
         bool m_regenerateStaminaAutomatically = true;
 
-        // Stamina application variables
-        float m_staminaPercentage = (m_sprintCooldown == 0.f) ? 100.f * (m_sprintMaxTime - m_sprintHeldDuration) / m_sprintMaxTime : 0.f;
-
         // Crouch application variables
         float m_crouchDistance = 0.5f;
         float m_crouchTime = 0.2f;
         float m_standTime = 0.2f;
-        float m_crouchPrevValue = 0.f;
-        bool m_crouching = false;
-        bool m_crouched = false;
-        bool m_standing = true;
-        float m_cameraLocalZTravelDistance = 0.f;
         bool m_crouchEnableToggle = true;
         bool m_crouchJumpCausesStanding = true;
         bool m_crouchSprintCausesStanding = false;
@@ -479,7 +960,6 @@ namespace FirstPersonController
 
         // Jumping and gravity
         float m_gravity = -30.f;
-        bool m_grounded = true;
         AZ::Vector3 m_velocityXCrossYDirection = AZ::Vector3::CreateAxisZ();
         AZ::Vector3 m_prevVelocityXCrossYDirection = AZ::Vector3::CreateAxisZ();
         AZ::Vector3 m_velocityZPosDirection = AZ::Vector3::CreateAxisZ();
@@ -490,41 +970,30 @@ namespace FirstPersonController
         AZStd::vector<AzPhysics::SceneQueryHit> m_groundHits;
         AZStd::vector<AzPhysics::SceneQueryHit> m_groundCloseHits;
         float m_maxGroundedAngleDegrees = 30.f;
-        bool m_scriptGrounded = true;
-        bool m_scriptSetGroundTick = false;
-        bool m_groundClose = true;
-        bool m_scriptGroundClose = true;
-        bool m_scriptSetGroundCloseTick = false;
-        float m_airTime = 0.f;
         float m_jumpInitialVelocity = 6.f;
         float m_jumpSecondInitialVelocity = 6.f;
-        bool m_jumpHeld = false;
-        bool m_jumpReqRepress = true;
-        float m_applyVelocityZ = 0.f;
-        float m_applyVelocityZCurrentDelta = 0.f;
-        float m_applyVelocityZPrevDelta = 0.f;
-        float m_correctedVelocityZ = 0.f;
         float m_capsuleRadius = 0.3f;
         float m_capsuleHeight = 1.8f;
-        float m_capsuleCurrentHeight = 1.8f;
         // The grounded sphere cast offset determines how far below the character's feet the ground is detected
         float m_groundedSphereCastOffset = 0.001f;
         // The ground close sphere cast offset determines how far below the character's feet the ground is considered to be close
         float m_groundCloseSphereCastOffset = 0.5f;
+        // When enabled, ground close is instead determined by the predicted time to impact being below m_groundCloseTimeThreshold
+        bool m_groundCloseTimeToImpact = false;
+        float m_groundCloseTimeThreshold = 0.2f;
         // The sphere cast jump hold offset is used to determine initial (ascending) distance of the of the jump
         // where the m_jumpHeldGravityFactor is applied to the gravity
         float m_jumpHoldDistance = 0.8f;
+        // Integrates the jump and gravity phases exactly within each step instead of with a per-step velocity delta
+        bool m_exactVelocityZ = false;
         // The value of 41.5% was determined to work well based on testing
         float m_groundSphereCastsRadiusPercentageIncrease = 41.5;
         float m_jumpHeldGravityFactor = 0.1f;
         // The m_jumpMaxHoldTime is computed inside UpdateJumpMaxHoldTime()
         float m_jumpMaxHoldTime = m_jumpHoldDistance / ((m_jumpInitialVelocity + sqrt(m_jumpInitialVelocity*m_jumpInitialVelocity + 2.f*m_gravity*m_jumpHeldGravityFactor*m_jumpHoldDistance)) / 2.f);
-        float m_jumpCounter = 0.f;
         float m_jumpFallingGravityFactor = 0.9f;
         bool m_doubleJumpEnabled = false;
-        bool m_secondJump = false;
         bool m_jumpHeadIgnoreDynamicRigidBodies = true;
-        bool m_headHit = false;
         bool m_headHitSetsApogee = true;
         AzPhysics::CollisionGroups::Id m_headCollisionGroupId = AzPhysics::CollisionGroups::Id();
         AzPhysics::CollisionGroup m_headCollisionGroup = AzPhysics::CollisionGroup::All;
@@ -542,9 +1011,6 @@ namespace FirstPersonController
         float m_yawSensitivity = 0.0035f;
 
         // Rotation-related variables
-        float m_currentHeading = 0.f;
-        bool m_scriptSetcurrentHeadingTick = false;
-        float m_currentPitch = 0.f;
         AZ::Quaternion m_newLookRotationDelta = AZ::Quaternion::CreateZero();
         float m_rotationDamp = 30.f;
         bool m_cameraSlerpInsteadOfLerpRotation = true;
@@ -553,21 +1019,13 @@ namespace FirstPersonController
         float m_cameraPitchMaxAngle = AZ::Constants::HalfPi;
         float m_cameraPitchMinAngle = -AZ::Constants::HalfPi;
 
-        // Used when a script wants to update the camera angle via the Request Bus or a gamepad
-        bool m_rotatingPitchViaScriptGamepad = false;
-        bool m_rotatingYawViaScriptGamepad = false;
-
         // Acceleration lerp movement
         float m_accel = 30.f;
         float m_jumpAccelFactor = 0.25f;
-        bool m_accelerating = false;
 
         // Deceleration factor
         float m_decel = 1.5f;
         float m_opposingDecel = 2.f;
-        float m_decelerationFactor = m_decel;
-        bool m_decelerationFactorApplied = false;
-        bool m_opposingDecelFactorApplied = false;
 
         // Movement scale factors
         // assuming the event value multipliers are all +1.0
@@ -580,8 +1038,6 @@ namespace FirstPersonController
         // This sphere cast determines how far above the charcter's head that an obstruction is detected
         // for allowing them to uncrouch
         float m_uncrouchHeadSphereCastOffset = 0.1f;
-        bool m_standPrevented = false;
-        bool m_standPreventedViaScript = false;
         AzPhysics::CollisionGroups::Id m_standCollisionGroupId = AzPhysics::CollisionGroups::Id();
         AzPhysics::CollisionGroup m_standCollisionGroup = AzPhysics::CollisionGroup::All;
         AZStd::vector<AZ::EntityId> m_standPreventedEntityIds;
@@ -618,15 +1074,6 @@ namespace FirstPersonController
         StartingPointInput::InputEventNotificationId m_jumpEventId;
         AZStd::string m_strJump = "Jump";
 
-        // Array of action names
-        AZStd::string* m_inputNames[9] = {
-            &m_strForward, &m_strBack,
-            &m_strLeft, &m_strRight,
-            &m_strYaw, &m_strPitch,
-            &m_strSprint, &m_strCrouch,
-            &m_strJump
-        };
-
         // Map of event IDs and event value multipliers
         AZStd::map<StartingPointInput::InputEventNotificationId*, float*> m_controlMap = {
             {&m_moveForwardEventId, &m_forwardValue},
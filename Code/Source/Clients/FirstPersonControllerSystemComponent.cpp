@@ -4,16 +4,84 @@
 
 #include "FirstPersonControllerSystemComponent.h"
 
+#include <AzCore/Component/TransformBus.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistryVisitorUtils.h>
+#include <AzCore/std/algorithm.h>
+
+#include <math.h>
 
 namespace FirstPersonController
 {
+    namespace
+    {
+        // Cell coordinates are packed into 21 bits each, which covers about a million cells along each axis
+        constexpr AZ::s32 SpatialHashCoordinateBits = 21;
+        constexpr AZ::s32 SpatialHashCoordinateLimit = (1 << (SpatialHashCoordinateBits - 1)) - 1;
+
+        AZ::s32 GetSpatialHashCoordinate(float value, float cellSize)
+        {
+            const float cell = floorf(value / cellSize);
+            return static_cast<AZ::s32>(AZStd::clamp(cell, float(-SpatialHashCoordinateLimit), float(SpatialHashCoordinateLimit)));
+        }
+
+        AZ::u64 PackSpatialHashCell(AZ::s32 x, AZ::s32 y, AZ::s32 z)
+        {
+            constexpr AZ::u64 mask = (AZ::u64(1) << SpatialHashCoordinateBits) - 1;
+            return (AZ::u64(x) & mask) | ((AZ::u64(y) & mask) << SpatialHashCoordinateBits) | ((AZ::u64(z) & mask) << (2 * SpatialHashCoordinateBits));
+        }
+    } // namespace
+
     void FirstPersonControllerSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         if (AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context))
         {
+            serialize->Class<FirstPersonControllerMovementProfile>()
+                ->Version(1)
+                ->Field("Forward Key", &FirstPersonControllerMovementProfile::m_forwardEventName)
+                ->Field("Back Key", &FirstPersonControllerMovementProfile::m_backEventName)
+                ->Field("Left Key", &FirstPersonControllerMovementProfile::m_leftEventName)
+                ->Field("Right Key", &FirstPersonControllerMovementProfile::m_rightEventName)
+                ->Field("Camera Yaw Rotate Input", &FirstPersonControllerMovementProfile::m_yawEventName)
+                ->Field("Camera Pitch Rotate Input", &FirstPersonControllerMovementProfile::m_pitchEventName)
+                ->Field("Sprint Key", &FirstPersonControllerMovementProfile::m_sprintEventName)
+                ->Field("Crouch Key", &FirstPersonControllerMovementProfile::m_crouchEventName)
+                ->Field("Jump Key", &FirstPersonControllerMovementProfile::m_jumpEventName)
+                ->Field("Grounded Collision Group", &FirstPersonControllerMovementProfile::m_groundedCollisionGroup)
+                ->Field("Jump Head Hit Collision Group", &FirstPersonControllerMovementProfile::m_jumpHeadCollisionGroup)
+                ->Field("Stand Prevention Collision Group", &FirstPersonControllerMovementProfile::m_standCollisionGroup)
+                ->Field("Top Walk Speed", &FirstPersonControllerMovementProfile::m_topWalkSpeed)
+                ->Field("Walk Acceleration", &FirstPersonControllerMovementProfile::m_walkAcceleration)
+                ->Field("Deceleration Factor", &FirstPersonControllerMovementProfile::m_deceleration)
+                ->Field("Opposing Direction Deceleration Factor", &FirstPersonControllerMovementProfile::m_opposingDeceleration)
+                ->Field("Forward Scale", &FirstPersonControllerMovementProfile::m_forwardScale)
+                ->Field("Back Scale", &FirstPersonControllerMovementProfile::m_backScale)
+                ->Field("Left Scale", &FirstPersonControllerMovementProfile::m_leftScale)
+                ->Field("Right Scale", &FirstPersonControllerMovementProfile::m_rightScale)
+                ->Field("Sprint Forward Scale", &FirstPersonControllerMovementProfile::m_sprintScaleForward)
+                ->Field("Sprint Back Scale", &FirstPersonControllerMovementProfile::m_sprintScaleBack)
+                ->Field("Sprint Left Scale", &FirstPersonControllerMovementProfile::m_sprintScaleLeft)
+                ->Field("Sprint Right Scale", &FirstPersonControllerMovementProfile::m_sprintScaleRight)
+                ->Field("Sprint Acceleration Scale", &FirstPersonControllerMovementProfile::m_sprintAccelScale)
+                ->Field("Sprint Max Time", &FirstPersonControllerMovementProfile::m_sprintMaxTime)
+                ->Field("Sprint Cooldown Time", &FirstPersonControllerMovementProfile::m_sprintCooldownTime)
+                ->Field("Sprint Regeneration Rate", &FirstPersonControllerMovementProfile::m_sprintRegenRate)
+                ->Field("Crouch Scale", &FirstPersonControllerMovementProfile::m_crouchScale)
+                ->Field("Crouch Distance", &FirstPersonControllerMovementProfile::m_crouchDistance)
+                ->Field("Crouch Time", &FirstPersonControllerMovementProfile::m_crouchTime)
+                ->Field("Stand Time", &FirstPersonControllerMovementProfile::m_standTime)
+                ->Field("Gravity", &FirstPersonControllerMovementProfile::m_gravity)
+                ->Field("Jump Initial Velocity", &FirstPersonControllerMovementProfile::m_jumpInitialVelocity)
+                ->Field("Jump Second Initial Velocity", &FirstPersonControllerMovementProfile::m_jumpSecondInitialVelocity)
+                ->Field("Jump Held Gravity Factor", &FirstPersonControllerMovementProfile::m_jumpHeldGravityFactor)
+                ->Field("Jump Falling Gravity Factor", &FirstPersonControllerMovementProfile::m_jumpFallingGravityFactor)
+                ->Field("Jump Acceleration Factor", &FirstPersonControllerMovementProfile::m_jumpAccelFactor)
+                ->Field("Jump Hold Distance", &FirstPersonControllerMovementProfile::m_jumpHoldDistance)
+                ;
+
             serialize->Class<FirstPersonControllerSystemComponent, AZ::Component>()
                 ->Version(0)
                 ;
@@ -63,12 +131,475 @@ namespace FirstPersonController
         }
     }
 
+    void FirstPersonControllerSystemComponent::RegisterController(const AZ::EntityId& entityId, FirstPersonControllerComponentRequests* requests, const FirstPersonControllerPublishedState* state)
+    {
+        auto entry = AZStd::make_shared<FirstPersonControllerRegistryEntry>();
+        entry->m_requests = requests;
+        entry->m_state = state;
+
+        // Invalidate any handles still referring to a previous registration for this entity
+        auto it = m_controllers.find(entityId);
+        if (it != m_controllers.end())
+        {
+            entry->m_relevant = it->second->m_relevant;
+            RemoveFromSpatialHash(*it->second);
+            if (it->second->m_pooled)
+            {
+                m_controllerPool.erase(AZStd::remove(m_controllerPool.begin(), m_controllerPool.end(), entityId), m_controllerPool.end());
+            }
+            it->second->m_requests = nullptr;
+            it->second->m_state = nullptr;
+            it->second = AZStd::move(entry);
+        }
+        else
+        {
+            m_controllers.emplace(entityId, AZStd::move(entry));
+        }
+    }
+
+    void FirstPersonControllerSystemComponent::UnregisterController(const AZ::EntityId& entityId)
+    {
+        auto it = m_controllers.find(entityId);
+        if (it == m_controllers.end())
+        {
+            return;
+        }
+
+        RemoveFromSpatialHash(*it->second);
+        if (it->second->m_pooled)
+        {
+            m_controllerPool.erase(AZStd::remove(m_controllerPool.begin(), m_controllerPool.end(), entityId), m_controllerPool.end());
+        }
+
+        // Handles share the entry, so clearing it here is what makes them report as invalid
+        it->second->m_requests = nullptr;
+        it->second->m_state = nullptr;
+        m_controllers.erase(it);
+    }
+
+    FirstPersonControllerHandle FirstPersonControllerSystemComponent::GetControllerHandle(const AZ::EntityId& entityId) const
+    {
+        auto it = m_controllers.find(entityId);
+        if (it == m_controllers.end())
+        {
+            return FirstPersonControllerHandle();
+        }
+        return FirstPersonControllerHandle(it->second);
+    }
+
+    AZ::u32 FirstPersonControllerSystemComponent::GetControllerCount() const
+    {
+        return static_cast<AZ::u32>(m_controllers.size());
+    }
+
+    AZStd::shared_ptr<const FirstPersonControllerMovementProfile> FirstPersonControllerSystemComponent::GetMovementProfile(const AZStd::string& profileName) const
+    {
+        auto it = m_movementProfiles.find(profileName);
+        if (it == m_movementProfiles.end())
+        {
+            return nullptr;
+        }
+        return it->second;
+    }
+
+    void FirstPersonControllerSystemComponent::SetMovementProfile(const AZStd::string& profileName, const FirstPersonControllerMovementProfile& profile)
+    {
+        m_movementProfiles[profileName] = AZStd::make_shared<const FirstPersonControllerMovementProfile>(profile);
+
+        for (auto& controller : m_controllers)
+        {
+            FirstPersonControllerComponentRequests* requests = controller.second->m_requests;
+            if (requests != nullptr && requests->GetMovementProfileName() == profileName)
+            {
+                // Setting the name again resolves the new instance, including for controllers that referenced it before it existed
+                requests->SetMovementProfileName(profileName);
+            }
+        }
+    }
+
+    AZStd::shared_ptr<const FirstPersonControllerMovementProfile> FirstPersonControllerSystemComponent::InternMovementProfile(const FirstPersonControllerMovementProfile& profile)
+    {
+        // There are only as many interned profiles as there are distinct archetypes, so a linear search is enough
+        for (auto it = m_internedMovementProfiles.begin(); it != m_internedMovementProfiles.end();)
+        {
+            AZStd::shared_ptr<const FirstPersonControllerMovementProfile> interned = it->lock();
+            if (interned == nullptr)
+            {
+                it = m_internedMovementProfiles.erase(it);
+                continue;
+            }
+            if (*interned == profile)
+            {
+                return interned;
+            }
+            ++it;
+        }
+
+        auto interned = AZStd::make_shared<const FirstPersonControllerMovementProfile>(profile);
+        m_internedMovementProfiles.push_back(interned);
+        return interned;
+    }
+
+    void FirstPersonControllerSystemComponent::AddLodViewer(const AZ::EntityId& viewerEntityId)
+    {
+        if (AZStd::find(m_lodViewers.begin(), m_lodViewers.end(), viewerEntityId) == m_lodViewers.end())
+        {
+            m_lodViewers.push_back(viewerEntityId);
+        }
+    }
+
+    void FirstPersonControllerSystemComponent::RemoveLodViewer(const AZ::EntityId& viewerEntityId)
+    {
+        auto it = AZStd::find(m_lodViewers.begin(), m_lodViewers.end(), viewerEntityId);
+        if (it != m_lodViewers.end())
+        {
+            m_lodViewers.erase(it);
+        }
+    }
+
+    void FirstPersonControllerSystemComponent::SetLodDistances(float fullRateDistance, float halfRateDistance, float quarterRateDistance)
+    {
+        AZ_Warning("FirstPersonControllerSystemComponent", fullRateDistance <= halfRateDistance && halfRateDistance <= quarterRateDistance,
+            "LOD distances should increase from the full rate distance to the quarter rate distance.");
+        m_lodFullRateDistance = fullRateDistance;
+        m_lodHalfRateDistance = halfRateDistance;
+        m_lodQuarterRateDistance = quarterRateDistance;
+    }
+
+    void FirstPersonControllerSystemComponent::SetControllerRelevant(const AZ::EntityId& entityId, bool relevant)
+    {
+        auto it = m_controllers.find(entityId);
+        if (it != m_controllers.end())
+        {
+            it->second->m_relevant = relevant;
+        }
+    }
+
+    AZ::u64 FirstPersonControllerSystemComponent::GetSpatialHashCell(const AZ::Vector3& position) const
+    {
+        return PackSpatialHashCell(
+            GetSpatialHashCoordinate(position.GetX(), m_spatialHashCellSize),
+            GetSpatialHashCoordinate(position.GetY(), m_spatialHashCellSize),
+            GetSpatialHashCoordinate(position.GetZ(), m_spatialHashCellSize));
+    }
+
+    void FirstPersonControllerSystemComponent::RemoveFromSpatialHash(FirstPersonControllerRegistryEntry& entry)
+    {
+        if (!entry.m_inSpatialHash)
+        {
+            return;
+        }
+
+        // Swap the last item of the cell into the removed item's slot
+        auto cellIt = m_spatialHash.find(entry.m_spatialHashCell);
+        AZStd::vector<SpatialHashItem>& cell = cellIt->second;
+        if (entry.m_spatialHashIndex != cell.size() - 1)
+        {
+            cell[entry.m_spatialHashIndex] = cell.back();
+            cell[entry.m_spatialHashIndex].m_entry->m_spatialHashIndex = entry.m_spatialHashIndex;
+        }
+        cell.pop_back();
+        entry.m_inSpatialHash = false;
+
+        // Erase emptied cells so that the map only holds occupied ones, which VisitSpatialHash() relies on
+        if (cell.empty())
+        {
+            m_spatialHash.erase(cellIt);
+        }
+    }
+
+    void FirstPersonControllerSystemComponent::UpdateSpatialHash()
+    {
+        for (auto& controller : m_controllers)
+        {
+            FirstPersonControllerRegistryEntry& entry = *controller.second;
+            if (entry.m_requests == nullptr || entry.m_state == nullptr || entry.m_pooled)
+            {
+                continue;
+            }
+
+            const AZ::Vector3 position = entry.m_state->Read().m_position;
+            const AZ::u64 cellKey = GetSpatialHashCell(position);
+            if (entry.m_inSpatialHash && entry.m_spatialHashCell == cellKey)
+            {
+                m_spatialHash[cellKey][entry.m_spatialHashIndex].m_position = position;
+                continue;
+            }
+
+            RemoveFromSpatialHash(entry);
+            AZStd::vector<SpatialHashItem>& cell = m_spatialHash[cellKey];
+            entry.m_spatialHashCell = cellKey;
+            entry.m_spatialHashIndex = static_cast<AZ::u32>(cell.size());
+            entry.m_inSpatialHash = true;
+            cell.push_back({ controller.first, position, &entry });
+        }
+    }
+
+    template<typename Visitor>
+    void FirstPersonControllerSystemComponent::VisitSpatialHash(const AZ::Aabb& box, Visitor&& visitor) const
+    {
+        const AZ::s32 minX = GetSpatialHashCoordinate(box.GetMin().GetX(), m_spatialHashCellSize);
+        const AZ::s32 minY = GetSpatialHashCoordinate(box.GetMin().GetY(), m_spatialHashCellSize);
+        const AZ::s32 minZ = GetSpatialHashCoordinate(box.GetMin().GetZ(), m_spatialHashCellSize);
+        const AZ::s32 maxX = GetSpatialHashCoordinate(box.GetMax().GetX(), m_spatialHashCellSize);
+        const AZ::s32 maxY = GetSpatialHashCoordinate(box.GetMax().GetY(), m_spatialHashCellSize);
+        const AZ::s32 maxZ = GetSpatialHashCoordinate(box.GetMax().GetZ(), m_spatialHashCellSize);
+
+        // When the box covers more cells than are occupied it's cheaper to walk the occupied cells
+        const AZ::u64 boxCellCount = AZ::u64(maxX - minX + 1) * AZ::u64(maxY - minY + 1) * AZ::u64(maxZ - minZ + 1);
+        if (boxCellCount > m_spatialHash.size())
+        {
+            for (const auto& cell : m_spatialHash)
+            {
+                for (const SpatialHashItem& item : cell.second)
+                {
+                    if (box.Contains(item.m_position))
+                    {
+                        visitor(item);
+                    }
+                }
+            }
+            return;
+        }
+
+        for (AZ::s32 x = minX; x <= maxX; ++x)
+        {
+            for (AZ::s32 y = minY; y <= maxY; ++y)
+            {
+                for (AZ::s32 z = minZ; z <= maxZ; ++z)
+                {
+                    auto it = m_spatialHash.find(PackSpatialHashCell(x, y, z));
+                    if (it == m_spatialHash.end())
+                    {
+                        continue;
+                    }
+                    for (const SpatialHashItem& item : it->second)
+                    {
+                        if (box.Contains(item.m_position))
+                        {
+                            visitor(item);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    void FirstPersonControllerSystemComponent::SetSpatialHashCellSize(float cellSize)
+    {
+        if (cellSize <= 0.f)
+        {
+            AZ_Warning("FirstPersonControllerSystemComponent", false, "Spatial hash cell size must be positive.");
+            return;
+        }
+
+        // Every controller is reinserted on the next update
+        m_spatialHashCellSize = cellSize;
+        m_spatialHash.clear();
+        for (auto& controller : m_controllers)
+        {
+            controller.second->m_inSpatialHash = false;
+        }
+        UpdateSpatialHash();
+    }
+
+    AZ::u32 FirstPersonControllerSystemComponent::QueryControllersInRadius(const AZ::Vector3& center, float radius, AZ::EntityId* results, AZ::u32 maxResults) const
+    {
+        return QueryControllersInRadius(center, radius, results, nullptr, maxResults);
+    }
+
+    AZ::u32 FirstPersonControllerSystemComponent::QueryControllersInRadius(const AZ::Vector3& center, float radius, AZ::EntityId* results, AZ::Vector3* positions, AZ::u32 maxResults) const
+    {
+        const float radiusSq = radius * radius;
+        AZ::u32 count = 0;
+        VisitSpatialHash(AZ::Aabb::CreateCenterRadius(center, radius),
+            [&](const SpatialHashItem& item)
+            {
+                if (item.m_position.GetDistanceSq(center) <= radiusSq)
+                {
+                    if (count < maxResults)
+                    {
+                        results[count] = item.m_entityId;
+                        if (positions != nullptr)
+                        {
+                            positions[count] = item.m_position;
+                        }
+                    }
+                    ++count;
+                }
+            });
+        return count;
+    }
+
+    AZ::u32 FirstPersonControllerSystemComponent::QueryControllersInBox(const AZ::Aabb& box, AZ::EntityId* results, AZ::u32 maxResults) const
+    {
+        AZ::u32 count = 0;
+        VisitSpatialHash(box,
+            [&](const SpatialHashItem& item)
+            {
+                if (count < maxResults)
+                {
+                    results[count] = item.m_entityId;
+                }
+                ++count;
+            });
+        return count;
+    }
+
+    void FirstPersonControllerSystemComponent::ReleaseControllerToPool(const AZ::EntityId& entityId, const AZ::Vector3& parkPosition)
+    {
+        auto it = m_controllers.find(entityId);
+        if (it == m_controllers.end() || it->second->m_requests == nullptr)
+        {
+            AZ_Warning("FirstPersonControllerSystemComponent", false, "Only an active controller can be released to the pool.");
+            return;
+        }
+
+        FirstPersonControllerRegistryEntry& entry = *it->second;
+        if (entry.m_pooled)
+        {
+            return;
+        }
+
+        entry.m_requests->SetPooled(true);
+        entry.m_requests->Teleport(parkPosition, 0.f);
+        entry.m_pooled = true;
+        RemoveFromSpatialHash(entry);
+        m_controllerPool.push_back(entityId);
+    }
+
+    AZ::EntityId FirstPersonControllerSystemComponent::AcquirePooledController(const AZ::Vector3& position, float heading)
+    {
+        while (!m_controllerPool.empty())
+        {
+            const AZ::EntityId entityId = m_controllerPool.back();
+            m_controllerPool.pop_back();
+
+            auto it = m_controllers.find(entityId);
+            if (it == m_controllers.end() || it->second->m_requests == nullptr)
+            {
+                continue;
+            }
+
+            FirstPersonControllerRegistryEntry& entry = *it->second;
+            entry.m_pooled = false;
+            entry.m_requests->Teleport(position, heading);
+            entry.m_requests->SetPooled(false);
+            return entityId;
+        }
+        return AZ::EntityId();
+    }
+
+    AZ::u32 FirstPersonControllerSystemComponent::GetPooledControllerCount() const
+    {
+        return static_cast<AZ::u32>(m_controllerPool.size());
+    }
+
+    void FirstPersonControllerSystemComponent::UpdateControllerLod()
+    {
+        m_lodViewerPositions.clear();
+        for (const AZ::EntityId& viewerEntityId : m_lodViewers)
+        {
+            // Viewers that have been deactivated are ignored until they come back
+            if (AZ::TransformBus::HasHandlers(viewerEntityId))
+            {
+                AZ::Vector3 viewerPosition = AZ::Vector3::CreateZero();
+                AZ::TransformBus::EventResult(viewerPosition, viewerEntityId, &AZ::TransformBus::Events::GetWorldTranslation);
+                m_lodViewerPositions.push_back(viewerPosition);
+            }
+        }
+
+        // Without a viewer position every controller runs at full rate, otherwise controllers start in the farthest tier
+        // and only the cells within the quarter rate distance of each viewer are visited to bring them closer
+        for (auto& controller : m_controllers)
+        {
+            FirstPersonControllerRegistryEntry& entry = *controller.second;
+            entry.m_nearestTier = (entry.m_relevant || m_lodViewerPositions.empty()) ? 0 : 3;
+        }
+
+        const float fullRateDistanceSq = m_lodFullRateDistance * m_lodFullRateDistance;
+        const float halfRateDistanceSq = m_lodHalfRateDistance * m_lodHalfRateDistance;
+        const float quarterRateDistanceSq = m_lodQuarterRateDistance * m_lodQuarterRateDistance;
+        for (const AZ::Vector3& viewerPosition : m_lodViewerPositions)
+        {
+            VisitSpatialHash(AZ::Aabb::CreateCenterRadius(viewerPosition, m_lodQuarterRateDistance),
+                [&](const SpatialHashItem& item)
+                {
+                    const float distanceSq = item.m_position.GetDistanceSq(viewerPosition);
+                    AZ::u32 tier = 3;
+                    if (distanceSq <= fullRateDistanceSq)
+                    {
+                        tier = 0;
+                    }
+                    else if (distanceSq <= halfRateDistanceSq)
+                    {
+                        tier = 1;
+                    }
+                    else if (distanceSq <= quarterRateDistanceSq)
+                    {
+                        tier = 2;
+                    }
+                    item.m_entry->m_nearestTier = AZStd::min(item.m_entry->m_nearestTier, tier);
+                });
+        }
+
+        // Each controller's phase comes from a hash of its entity id, which spreads the controllers of a tier evenly over
+        // the steps while keeping a controller's phase from changing when other controllers enter or leave its tier
+        constexpr AZ::u32 tierIntervals[4] = { 1, 2, 4, 4 };
+
+        for (auto& controller : m_controllers)
+        {
+            FirstPersonControllerRegistryEntry& entry = *controller.second;
+            if (entry.m_requests == nullptr)
+            {
+                continue;
+            }
+
+            const AZ::u32 tier = entry.m_nearestTier;
+            const AZ::u64 idHash = static_cast<AZ::u64>(controller.first) * 0x9E3779B97F4A7C15ull;
+            const AZ::u32 phase = static_cast<AZ::u32>(idHash >> 32) % tierIntervals[tier];
+            if (tier != entry.m_updateTier || phase != entry.m_updatePhase)
+            {
+                entry.m_updateTier = tier;
+                entry.m_updatePhase = phase;
+                entry.m_requests->SetUpdateTier(tier, phase);
+            }
+        }
+    }
+
+    void FirstPersonControllerSystemComponent::LoadMovementProfiles()
+    {
+        auto* settingsRegistry = AZ::SettingsRegistry::Get();
+        if (settingsRegistry == nullptr)
+        {
+            return;
+        }
+
+        auto loadProfile = [this, settingsRegistry](const AZ::SettingsRegistryInterface::VisitArgs& visitArgs)
+        {
+            FirstPersonControllerMovementProfile profile;
+            if (settingsRegistry->GetObject(profile, visitArgs.m_jsonKeyPath))
+            {
+                m_movementProfiles[AZStd::string(visitArgs.m_fieldName)] = AZStd::make_shared<const FirstPersonControllerMovementProfile>(AZStd::move(profile));
+            }
+            else
+            {
+                AZ_Warning("FirstPersonControllerSystemComponent", false, "Failed to load movement profile at \"%.*s\".",
+                    AZ_STRING_ARG(visitArgs.m_jsonKeyPath));
+            }
+            return AZ::SettingsRegistryInterface::VisitResponse::Skip;
+        };
+        AZ::SettingsRegistryVisitorUtils::VisitObject(*settingsRegistry, loadProfile, MovementProfilesRegistryPath);
+    }
+
     void FirstPersonControllerSystemComponent::Init()
     {
     }
 
     void FirstPersonControllerSystemComponent::Activate()
     {
+        LoadMovementProfiles();
+
         FirstPersonControllerRequestBus::Handler::BusConnect();
         AZ::TickBus::Handler::BusConnect();
     }
@@ -77,10 +608,23 @@ namespace FirstPersonController
     {
         AZ::TickBus::Handler::BusDisconnect();
         FirstPersonControllerRequestBus::Handler::BusDisconnect();
+
+        for (auto& controller : m_controllers)
+        {
+            controller.second->m_requests = nullptr;
+            controller.second->m_state = nullptr;
+        }
+        m_controllers.clear();
+        m_spatialHash.clear();
+        m_controllerPool.clear();
+        m_movementProfiles.clear();
+        m_internedMovementProfiles.clear();
     }
 
     void FirstPersonControllerSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
     {
+        UpdateSpatialHash();
+        UpdateControllerLod();
     }
 
 } // namespace FirstPersonController
@@ -6,6 +6,10 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/weak_ptr.h>
+#include <AzCore/std/string/string.h>
 #include <FirstPersonController/FirstPersonControllerBus.h>
 
 namespace FirstPersonController
@@ -31,7 +35,24 @@ namespace FirstPersonController
     protected:
         ////////////////////////////////////////////////////////////////////////
         // FirstPersonControllerRequestBus interface implementation
-
+        void RegisterController(const AZ::EntityId& entityId, FirstPersonControllerComponentRequests* requests, const FirstPersonControllerPublishedState* state) override;
+        void UnregisterController(const AZ::EntityId& entityId) override;
+        FirstPersonControllerHandle GetControllerHandle(const AZ::EntityId& entityId) const override;
+        AZ::u32 GetControllerCount() const override;
+        AZStd::shared_ptr<const FirstPersonControllerMovementProfile> GetMovementProfile(const AZStd::string& profileName) const override;
+        void SetMovementProfile(const AZStd::string& profileName, const FirstPersonControllerMovementProfile& profile) override;
+        AZStd::shared_ptr<const FirstPersonControllerMovementProfile> InternMovementProfile(const FirstPersonControllerMovementProfile& profile) override;
+        void AddLodViewer(const AZ::EntityId& viewerEntityId) override;
+        void RemoveLodViewer(const AZ::EntityId& viewerEntityId) override;
+        void SetLodDistances(float fullRateDistance, float halfRateDistance, float quarterRateDistance) override;
+        void SetControllerRelevant(const AZ::EntityId& entityId, bool relevant) override;
+        void SetSpatialHashCellSize(float cellSize) override;
+        AZ::u32 QueryControllersInRadius(const AZ::Vector3& center, float radius, AZ::EntityId* results, AZ::u32 maxResults) const override;
+        AZ::u32 QueryControllersInRadius(const AZ::Vector3& center, float radius, AZ::EntityId* results, AZ::Vector3* positions, AZ::u32 maxResults) const override;
+        AZ::u32 QueryControllersInBox(const AZ::Aabb& box, AZ::EntityId* results, AZ::u32 maxResults) const override;
+        void ReleaseControllerToPool(const AZ::EntityId& entityId, const AZ::Vector3& parkPosition) override;
+        AZ::EntityId AcquirePooledController(const AZ::Vector3& position, float heading) override;
+        AZ::u32 GetPooledControllerCount() const override;
         ////////////////////////////////////////////////////////////////////////
 
         ////////////////////////////////////////////////////////////////////////
@@ -45,6 +66,44 @@ namespace FirstPersonController
         // AZTickBus interface implementation
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
         ////////////////////////////////////////////////////////////////////////
+
+    private:
+        // Active controllers, keyed by the EntityId of the entity they are on
+        AZStd::unordered_map<AZ::EntityId, AZStd::shared_ptr<FirstPersonControllerRegistryEntry>> m_controllers;
+
+        // Named movement profiles, each shared by every controller that references it. A profile is never modified once
+        // shared, setting it replaces the instance so that a step in progress keeps reading the values it started with.
+        void LoadMovementProfiles();
+        AZStd::unordered_map<AZStd::string, AZStd::shared_ptr<const FirstPersonControllerMovementProfile>> m_movementProfiles;
+        // Unnamed profiles built from the controllers' own values, released once no controller references them
+        AZStd::vector<AZStd::weak_ptr<const FirstPersonControllerMovementProfile>> m_internedMovementProfiles;
+
+        // Uniform grid of controller positions, keyed by the packed cell coordinates. A controller is only moved between
+        // cells when it crosses a cell boundary, and a cell is erased once it's emptied so that the map only holds occupied cells.
+        struct SpatialHashItem
+        {
+            AZ::EntityId m_entityId;
+            AZ::Vector3 m_position;
+            FirstPersonControllerRegistryEntry* m_entry;
+        };
+        AZ::u64 GetSpatialHashCell(const AZ::Vector3& position) const;
+        void UpdateSpatialHash();
+        void RemoveFromSpatialHash(FirstPersonControllerRegistryEntry& entry);
+        template<typename Visitor>
+        void VisitSpatialHash(const AZ::Aabb& box, Visitor&& visitor) const;
+        AZStd::unordered_map<AZ::u64, AZStd::vector<SpatialHashItem>> m_spatialHash;
+        float m_spatialHashCellSize = 8.f;
+
+        // Released controllers waiting to be acquired, the most recently released is handed out first
+        AZStd::vector<AZ::EntityId> m_controllerPool;
+
+        // Distance-based update LOD, assigned to the controllers once per tick
+        void UpdateControllerLod();
+        AZStd::vector<AZ::EntityId> m_lodViewers;
+        AZStd::vector<AZ::Vector3> m_lodViewerPositions;
+        float m_lodFullRateDistance = 30.f;
+        float m_lodHalfRateDistance = 60.f;
+        float m_lodQuarterRateDistance = 120.f;
     };
 
 } // namespace FirstPersonController
@@ -0,0 +1,89 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/base.h>
+
+#include <math.h>
+
+namespace FirstPersonController
+{
+    // Scale a vector in the character's frame of reference onto the ellipse formed by the four direction scales.
+    // This is the closed form of the per-quadrant angle calculation: the forward or back scale is picked by the sign
+    // of Y and the left or right scale by the sign of X, and a vector that isn't normalized has its length applied.
+    inline void EllipseScaleXY(const float x, const float y, const float forwardScale, const float backScale,
+        const float leftScale, const float rightScale, float& outX, float& outY)
+    {
+        const float forwardBack = (y >= 0.f) ? forwardScale : backScale;
+        const float leftRight = (x >= 0.f) ? rightScale : leftScale;
+        const float denominator = sqrt(forwardBack*forwardBack * x*x + leftRight*leftRight * y*y);
+        if(denominator == 0.f)
+        {
+            outX = outY = 0.f;
+            return;
+        }
+
+        const float factor = forwardBack * leftRight * sqrt(x*x + y*y) / denominator;
+        outX = x * factor;
+        outY = y * factor;
+    }
+
+    // Rotate a vector in the XY plane about Z by the character's heading
+    inline void RotateXY(const float x, const float y, const float heading, float& outX, float& outY)
+    {
+        const float s = sin(heading);
+        const float c = cos(heading);
+        outX = x * c - y * s;
+        outY = x * s + y * c;
+    }
+
+    // One step of the lerped X&Y velocity model. The lerp time is advanced by half of the step before the velocity is
+    // sampled and by the other half after, so the velocity returned is the one at the middle of the step.
+    inline AZ::Vector2 LerpVelocityXYStep(const AZ::Vector2& startVelocityXY, const AZ::Vector2& targetVelocityXY,
+        const float totalLerpTime, const float lerpDeltaTime, float& lerpTime)
+    {
+        lerpTime += lerpDeltaTime * 0.5f;
+
+        if(lerpTime >= totalLerpTime)
+            lerpTime = totalLerpTime;
+
+        const AZ::Vector2 velocityXY = startVelocityXY.Lerp(targetVelocityXY, lerpTime / totalLerpTime);
+
+        if(lerpTime != totalLerpTime)
+            lerpTime += lerpDeltaTime * 0.5f;
+
+        return velocityXY;
+    }
+
+    // One step of the analytic X&Y velocity model, which moves the velocity toward the target velocity at a bounded rate.
+    // The velocity at the end of the step is written to endVelocityXY and the average over the step is returned, which
+    // keeps the distance travelled independent of the step rate.
+    inline AZ::Vector2 RampVelocityXY(const AZ::Vector2& startVelocityXY, const AZ::Vector2& targetVelocityXY,
+        const float rate, const float deltaTime, AZ::Vector2& endVelocityXY)
+    {
+        const AZ::Vector2 deltaVelocityXY = targetVelocityXY - startVelocityXY;
+        const float deltaVelocityLength = deltaVelocityXY.GetLength();
+
+        // Time within this step at which the target velocity is reached
+        const float reachTime = (rate > 0.f) ? deltaVelocityLength / rate : deltaTime + 1.f;
+
+        if(reachTime < deltaTime)
+        {
+            // Ramp for part of the step and hold the target velocity for the remainder
+            const float rampFraction = reachTime / deltaTime;
+            endVelocityXY = targetVelocityXY;
+            return (startVelocityXY + targetVelocityXY) * 0.5f * rampFraction + targetVelocityXY * (1.f - rampFraction);
+        }
+        else if(reachTime > deltaTime)
+        {
+            endVelocityXY = startVelocityXY + deltaVelocityXY * (rate * deltaTime / deltaVelocityLength);
+            return (startVelocityXY + endVelocityXY) * 0.5f;
+        }
+
+        endVelocityXY = targetVelocityXY;
+        return (startVelocityXY + targetVelocityXY) * 0.5f;
+    }
+} // namespace FirstPersonController
@@ -0,0 +1,93 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#pragma once
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+
+namespace FirstPersonController
+{
+    // Gravity parameters of the character's vertical motion. The gravity is expected to be negative.
+    struct VerticalMotionParams
+    {
+        float m_gravity = -30.f;
+        float m_heldGravityFactor = 0.1f;
+        float m_fallingGravityFactor = 0.9f;
+    };
+
+    // Advance the vertical velocity over a duration of constant acceleration, stopping early when a rising velocity reaches
+    // zero so that the caller can switch to the next phase. Returns the time that was consumed and accumulates the displacement.
+    inline float AdvanceVerticalPhase(float& velocityZ, float& displacement, const float acceleration, const float duration, const bool stopAtApogee)
+    {
+        float phaseTime = duration;
+        if(stopAtApogee && velocityZ > 0.f && acceleration < 0.f)
+            phaseTime = AZStd::min(phaseTime, -velocityZ / acceleration);
+
+        displacement += velocityZ * phaseTime + 0.5f * acceleration * phaseTime * phaseTime;
+        velocityZ += acceleration * phaseTime;
+        return phaseTime;
+    }
+
+    // Exact piecewise-analytic integration of the vertical velocity over a step. The held jump gravity factor applies for up to
+    // holdTime while rising, normal gravity applies for the rest of the ascent, and the falling gravity factor applies once the
+    // velocity is no longer positive. Since each phase has constant acceleration, the result doesn't depend on how a motion
+    // is divided into steps. Returns the displacement over the step and leaves the velocity at the end of the step in velocityZ.
+    inline float IntegrateVerticalMotion(float& velocityZ, float holdTime, float duration, const VerticalMotionParams& params)
+    {
+        float displacement = 0.f;
+
+        // Held jump
+        if(holdTime > 0.f && velocityZ > 0.f)
+            duration -= AdvanceVerticalPhase(velocityZ, displacement, params.m_gravity * params.m_heldGravityFactor, AZStd::min(holdTime, duration), true);
+
+        // Remainder of the ascent
+        if(duration > 0.f && velocityZ > 0.f)
+            duration -= AdvanceVerticalPhase(velocityZ, displacement, params.m_gravity, duration, true);
+
+        // Falling
+        if(duration > 0.f)
+            AdvanceVerticalPhase(velocityZ, displacement, params.m_gravity * params.m_fallingGravityFactor, duration, false);
+
+        return displacement;
+    }
+
+    // Closed-form apex of a jump launched with the given velocity and held for holdTime. Returns false when gravity can't end
+    // the ascent. The time to the apex and the apex height relative to the launch are written to the output parameters.
+    inline bool PredictVerticalApex(float velocityZ, const float holdTime, const VerticalMotionParams& params, float& timeToApex, float& apexHeight)
+    {
+        timeToApex = 0.f;
+        apexHeight = 0.f;
+        if(params.m_gravity >= 0.f)
+            return false;
+
+        const float heldGravity = params.m_gravity * params.m_heldGravityFactor;
+        if(holdTime > 0.f && velocityZ > 0.f)
+        {
+            float heldTime = holdTime;
+            if(heldGravity < 0.f)
+                heldTime = AZStd::min(heldTime, -velocityZ / heldGravity);
+            apexHeight += velocityZ * heldTime + 0.5f * heldGravity * heldTime * heldTime;
+            velocityZ += heldGravity * heldTime;
+            timeToApex += heldTime;
+        }
+
+        if(velocityZ > 0.f)
+        {
+            apexHeight += velocityZ * velocityZ / (-2.f * params.m_gravity);
+            timeToApex += velocityZ / -params.m_gravity;
+        }
+
+        return true;
+    }
+
+    // Closed-form time to fall a distance with the falling gravity factor applied, starting with a velocity that is not positive
+    inline float PredictVerticalFallTime(const float distance, const float velocityZ, const VerticalMotionParams& params)
+    {
+        const float fallingGravity = params.m_gravity * params.m_fallingGravityFactor;
+        if(distance <= 0.f || fallingGravity >= 0.f)
+            return 0.f;
+        return (velocityZ + sqrt(velocityZ * velocityZ - 2.f * fallingGravity * distance)) / -fallingGravity;
+    }
+} // namespace FirstPersonController
@@ -1,4 +1,338 @@
 
 #include <AzTest/AzTest.h>
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/std/containers/vector.h>
+
+#if defined(HAVE_BENCHMARK)
+#include <benchmark/benchmark.h>
+#endif
+
+#include <Clients/FirstPersonControllerVelocityKernel.h>
+#include <Clients/FirstPersonControllerVerticalMotion.h>
+
+namespace UnitTest
+{
+    using namespace FirstPersonController;
+
+    // Accelerate from rest to the target velocity with both X&Y velocity models, returning the speed reached and the
+    // time at which it's first reached
+    static void AccelerateVelocityXY(bool analytic, const AZ::Vector2& targetVelocityXY, float accel, float deltaTime,
+        float& topSpeed, float& timeToSpeed)
+    {
+        const AZ::Vector2 startVelocityXY = AZ::Vector2::CreateZero();
+        const float totalLerpTime = startVelocityXY.GetDistance(targetVelocityXY) / accel;
+        float lerpTime = 0.f;
+        AZ::Vector2 endVelocityXY = startVelocityXY;
+
+        topSpeed = 0.f;
+        timeToSpeed = -1.f;
+        for(int step = 1; step <= 600; ++step)
+        {
+            const AZ::Vector2 velocityXY = analytic
+                ? RampVelocityXY(endVelocityXY, targetVelocityXY, accel, deltaTime, endVelocityXY)
+                : LerpVelocityXYStep(startVelocityXY, targetVelocityXY, totalLerpTime, deltaTime, lerpTime);
+
+            topSpeed = AZ::GetMax(topSpeed, velocityXY.GetLength());
+            if(timeToSpeed < 0.f && velocityXY.IsClose(targetVelocityXY, 1e-4f))
+                timeToSpeed = (step - 1) * deltaTime;
+        }
+    }
+
+    TEST(FirstPersonControllerVelocityXYTest, AnalyticModelMatchesLerpModelTopSpeedAndTimeToSpeed)
+    {
+        const AZ::Vector2 targetVelocityXY(3.f, 4.f);
+        const float accel = 30.f;
+
+        for(const float deltaTime: {1.f/20.f, 1.f/60.f, 1.f/240.f})
+        {
+            float lerpTopSpeed, lerpTimeToSpeed, analyticTopSpeed, analyticTimeToSpeed;
+            AccelerateVelocityXY(false, targetVelocityXY, accel, deltaTime, lerpTopSpeed, lerpTimeToSpeed);
+            AccelerateVelocityXY(true, targetVelocityXY, accel, deltaTime, analyticTopSpeed, analyticTimeToSpeed);
+
+            EXPECT_NEAR(lerpTopSpeed, targetVelocityXY.GetLength(), 1e-4f);
+            EXPECT_NEAR(analyticTopSpeed, lerpTopSpeed, 1e-4f);
+
+            // Both reach the target velocity at the time that the acceleration takes to cover the change in velocity,
+            // rounded to the step that it falls in
+            ASSERT_GT(lerpTimeToSpeed, 0.f);
+            ASSERT_GT(analyticTimeToSpeed, 0.f);
+            EXPECT_NEAR(analyticTimeToSpeed, lerpTimeToSpeed, deltaTime + 1e-4f);
+            EXPECT_NEAR(analyticTimeToSpeed, targetVelocityXY.GetLength() / accel, deltaTime + 1e-4f);
+        }
+    }
+
+    TEST(FirstPersonControllerVelocityXYTest, AnalyticModelStepAverageMatchesLerpModelMidpointWhileRamping)
+    {
+        const AZ::Vector2 targetVelocityXY(0.f, 6.f);
+        const float accel = 12.f;
+        const float deltaTime = 1.f/60.f;
+        const float totalLerpTime = targetVelocityXY.GetLength() / accel;
+
+        float lerpTime = 0.f;
+        AZ::Vector2 endVelocityXY = AZ::Vector2::CreateZero();
+        // Stop short of the step in which the target is reached, where the lerp model snaps to it
+        for(int step = 0; (step + 1) * deltaTime < totalLerpTime; ++step)
+        {
+            const AZ::Vector2 lerpVelocityXY = LerpVelocityXYStep(AZ::Vector2::CreateZero(), targetVelocityXY, totalLerpTime, deltaTime, lerpTime);
+            const AZ::Vector2 analyticVelocityXY = RampVelocityXY(endVelocityXY, targetVelocityXY, accel, deltaTime, endVelocityXY);
+            EXPECT_TRUE(analyticVelocityXY.IsClose(lerpVelocityXY, 1e-4f));
+        }
+    }
+    // Step a held jump from launch to landing, returning the apex height and the landing time. The apex and the landing
+    // are located inside the step that contains them with the closed-form predictions, so only the stepping can differ.
+    static void StepJump(float velocityZ, float holdDuration, const VerticalMotionParams& params, float deltaTime,
+        float& apexHeight, float& landingTime)
+    {
+        float height = 0.f;
+        float time = 0.f;
+        apexHeight = -1.f;
+        landingTime = -1.f;
+        for(int step = 0; step < 10000 && landingTime < 0.f; ++step)
+        {
+            const float holdTime = AZStd::max(holdDuration - time, 0.f);
+            const float startHeight = height;
+            const float startVelocityZ = velocityZ;
+            height += IntegrateVerticalMotion(velocityZ, holdTime, deltaTime, params);
+
+            if(startVelocityZ > 0.f && velocityZ <= 0.f)
+            {
+                float timeToApex, stepApexHeight;
+                PredictVerticalApex(startVelocityZ, holdTime, params, timeToApex, stepApexHeight);
+                apexHeight = startHeight + stepApexHeight;
+            }
+            if(startVelocityZ <= 0.f && height <= 0.f)
+                landingTime = time + PredictVerticalFallTime(startHeight, startVelocityZ, params);
+
+            time += deltaTime;
+        }
+    }
+
+    TEST(FirstPersonControllerVerticalMotionTest, ApexAndLandingDoNotDependOnStepRate)
+    {
+        VerticalMotionParams params;
+        const float jumpVelocity = 6.f;
+        const float holdDuration = 0.2f;
+
+        float predictedTimeToApex, predictedApexHeight;
+        ASSERT_TRUE(PredictVerticalApex(jumpVelocity, holdDuration, params, predictedTimeToApex, predictedApexHeight));
+        const float predictedLandingTime = predictedTimeToApex + PredictVerticalFallTime(predictedApexHeight, 0.f, params);
+
+        for(const float deltaTime: {1.f/20.f, 1.f/60.f, 1.f/240.f})
+        {
+            float apexHeight, landingTime;
+            StepJump(jumpVelocity, holdDuration, params, deltaTime, apexHeight, landingTime);
+
+            EXPECT_NEAR(apexHeight, predictedApexHeight, 1e-3f);
+            EXPECT_NEAR(landingTime, predictedLandingTime, 1e-3f);
+        }
+    }
+    // The per-quadrant angle calculation that CreateEllipseScaledVector() used before it was replaced by the closed form in
+    // EllipseScaleXY(), which it now calls directly
+    static AZ::Vector2 BaselineEllipseScaledVector(const AZ::Vector2& unscaledVector, float forwardScale, float backScale, float leftScale, float rightScale)
+    {
+        AZ::Vector2 scaledVector = AZ::Vector2::CreateZero();
+
+        if(unscaledVector.IsZero())
+            return AZ::Vector2::CreateZero();
+
+        if(!unscaledVector.IsNormalized())
+        {
+            forwardScale *= unscaledVector.GetLength();
+            backScale *= unscaledVector.GetLength();
+            leftScale *= unscaledVector.GetLength();
+            rightScale *= unscaledVector.GetLength();
+        }
+
+        if(unscaledVector.GetY() >= 0.f && unscaledVector.GetX() >= 0.f)
+        {
+            scaledVector.SetX((forwardScale * rightScale) /
+                sqrt(forwardScale*forwardScale + rightScale*rightScale * pow(tan(unscaledVector.AngleSafe(AZ::Vector2::CreateAxisX())), 2.f)));
+            scaledVector.SetY(scaledVector.GetX()*tan(unscaledVector.AngleSafe(AZ::Vector2::CreateAxisX())));
+        }
+        else if(unscaledVector.GetY() >= 0.f && unscaledVector.GetX() < 0.f)
+        {
+            scaledVector.SetX(-1.f*(forwardScale * leftScale) /
+                sqrt(forwardScale*forwardScale + leftScale*leftScale * pow(tan(unscaledVector.AngleSafe(AZ::Vector2::CreateAxisX(-1.f))), 2.f)));
+            scaledVector.SetY(-1.f*scaledVector.GetX()*tan(unscaledVector.AngleSafe(AZ::Vector2::CreateAxisX(-1.f))));
+        }
+        else if(unscaledVector.GetY() < 0.f && unscaledVector.GetX() < 0.f)
+        {
+            scaledVector.SetX(-1.f*(backScale * leftScale) /
+                sqrt(backScale*backScale + leftScale*leftScale * pow(tan(unscaledVector.AngleSafe(AZ::Vector2::CreateAxisX(-1.f))), 2.f)));
+            scaledVector.SetY(scaledVector.GetX()*tan(unscaledVector.AngleSafe(AZ::Vector2::CreateAxisX(-1.f))));
+        }
+        else
+        {
+            scaledVector.SetX((backScale * rightScale) /
+                sqrt(backScale*backScale + rightScale*rightScale * pow(tan(unscaledVector.AngleSafe(AZ::Vector2::CreateAxisX())), 2.f)));
+            scaledVector.SetY(-1.f*scaledVector.GetX()*tan(unscaledVector.AngleSafe(AZ::Vector2::CreateAxisX())));
+        }
+
+        return scaledVector;
+    }
+
+    TEST(FirstPersonControllerVelocityKernelTest, EllipseScaleMatchesBaselinePerQuadrant)
+    {
+        const float forwardScale = 1.5f, backScale = 0.75f, leftScale = 1.25f, rightScale = 1.1f;
+
+        // Angles in every quadrant, kept off the axes where the baseline's tangent is unbounded
+        for(int i = 0; i < 36; ++i)
+        {
+            const float angle = AZ::DegToRad(10.f * i + 5.f);
+            for(const float length: {1.f, 0.5f, 2.5f})
+            {
+                const AZ::Vector2 unscaledVector = AZ::Vector2(cos(angle), sin(angle)) * length;
+                const AZ::Vector2 expected = BaselineEllipseScaledVector(unscaledVector, forwardScale, backScale, leftScale, rightScale);
+
+                float scaledX, scaledY;
+                EllipseScaleXY(unscaledVector.GetX(), unscaledVector.GetY(), forwardScale, backScale, leftScale, rightScale, scaledX, scaledY);
+                EXPECT_NEAR(scaledX, expected.GetX(), 1e-4f * length);
+                EXPECT_NEAR(scaledY, expected.GetY(), 1e-4f * length);
+            }
+        }
+
+        float scaledX = 1.f, scaledY = 1.f;
+        EllipseScaleXY(0.f, 0.f, forwardScale, backScale, leftScale, rightScale, scaledX, scaledY);
+        EXPECT_EQ(scaledX, 0.f);
+        EXPECT_EQ(scaledY, 0.f);
+    }
+
+    TEST(FirstPersonControllerVelocityKernelTest, RotateMatchesQuaternionRotation)
+    {
+        for(const float heading: {0.f, 0.5f, -2.f, 3.1f, -6.f})
+        {
+            const AZ::Vector2 unrotatedVector(1.5f, -0.7f);
+            const AZ::Vector2 expected = AZ::Vector2(AZ::Quaternion::CreateRotationZ(heading).TransformVector(AZ::Vector3(unrotatedVector)));
+
+            float rotatedX, rotatedY;
+            RotateXY(unrotatedVector.GetX(), unrotatedVector.GetY(), heading, rotatedX, rotatedY);
+            EXPECT_NEAR(rotatedX, expected.GetX(), 1e-4f);
+            EXPECT_NEAR(rotatedY, expected.GetY(), 1e-4f);
+        }
+    }
+
+#if defined(HAVE_BENCHMARK)
+    // Compares the closed-form kernels that the step uses against the calculations they replaced, over vectors in every
+    // quadrant. Run with the FirstPersonController.Benchmarks target.
+    class FirstPersonControllerVelocityKernelBenchmark : public benchmark::Fixture
+    {
+    public:
+        void SetUp(const benchmark::State&) override
+        {
+            m_vectors.clear();
+            for(int i = 0; i < 64; ++i)
+            {
+                const float angle = AZ::DegToRad(5.625f * i + 1.f);
+                m_vectors.push_back(AZ::Vector2(cos(angle), sin(angle)) * (0.5f + 0.05f * i));
+            }
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            m_vectors = {};
+        }
+
+        AZStd::vector<AZ::Vector2> m_vectors;
+    };
+
+    BENCHMARK_F(FirstPersonControllerVelocityKernelBenchmark, EllipseScaleBaseline)(benchmark::State& state)
+    {
+        for(auto _ : state)
+            for(const AZ::Vector2& unscaledVector: m_vectors)
+                benchmark::DoNotOptimize(BaselineEllipseScaledVector(unscaledVector, 1.5f, 0.75f, 1.25f, 1.1f));
+        state.SetItemsProcessed(state.iterations() * m_vectors.size());
+    }
+
+    BENCHMARK_F(FirstPersonControllerVelocityKernelBenchmark, EllipseScaleClosedForm)(benchmark::State& state)
+    {
+        for(auto _ : state)
+            for(const AZ::Vector2& unscaledVector: m_vectors)
+            {
+                float scaledX, scaledY;
+                EllipseScaleXY(unscaledVector.GetX(), unscaledVector.GetY(), 1.5f, 0.75f, 1.25f, 1.1f, scaledX, scaledY);
+                benchmark::DoNotOptimize(scaledX);
+                benchmark::DoNotOptimize(scaledY);
+            }
+        state.SetItemsProcessed(state.iterations() * m_vectors.size());
+    }
+
+    BENCHMARK_F(FirstPersonControllerVelocityKernelBenchmark, RotateQuaternion)(benchmark::State& state)
+    {
+        float heading = 0.f;
+        for(auto _ : state)
+            for(const AZ::Vector2& unrotatedVector: m_vectors)
+            {
+                benchmark::DoNotOptimize(AZ::Vector2(AZ::Quaternion::CreateRotationZ(heading).TransformVector(AZ::Vector3(unrotatedVector))));
+                heading += 0.01f;
+            }
+        state.SetItemsProcessed(state.iterations() * m_vectors.size());
+    }
+
+    BENCHMARK_F(FirstPersonControllerVelocityKernelBenchmark, RotateClosedForm)(benchmark::State& state)
+    {
+        float heading = 0.f;
+        for(auto _ : state)
+            for(const AZ::Vector2& unrotatedVector: m_vectors)
+            {
+                float rotatedX, rotatedY;
+                RotateXY(unrotatedVector.GetX(), unrotatedVector.GetY(), heading, rotatedX, rotatedY);
+                benchmark::DoNotOptimize(rotatedX);
+                benchmark::DoNotOptimize(rotatedY);
+                heading += 0.01f;
+            }
+        state.SetItemsProcessed(state.iterations() * m_vectors.size());
+    }
+
+    // Per-step state of a controller laid out as before and after the component's HotState block. The fields a step
+    // reads and writes are either spread one per cache line between configuration members, or packed together at the
+    // start of the object. Both layouts are the same size, so only the locality differs.
+    constexpr size_t HotFieldCount = 24;
+    constexpr size_t ControllerSize = 2048;
+
+    struct ScatteredControllerLayout
+    {
+        struct Line
+        {
+            float m_hot;
+            char m_cold[60];
+        };
+        Line m_lines[ControllerSize / sizeof(Line)];
+        float& Field(size_t index) { return m_lines[index].m_hot; }
+    };
+
+    struct PackedControllerLayout
+    {
+        float m_hot[HotFieldCount];
+        char m_cold[ControllerSize - sizeof(float) * HotFieldCount];
+        float& Field(size_t index) { return m_hot[index]; }
+    };
+
+    static_assert(sizeof(ScatteredControllerLayout) == sizeof(PackedControllerLayout), "The layouts must only differ in locality");
+
+    template<typename Layout>
+    static void StepControllerLayout(benchmark::State& state)
+    {
+        AZStd::vector<Layout> controllers(static_cast<size_t>(state.range(0)));
+        for(auto _ : state)
+        {
+            // Each field depends on the one before it, as a step's values do, which also keeps the packed layout
+            // from being vectorized so that the comparison is of memory access alone
+            for(Layout& controller: controllers)
+            {
+                float carry = 0.01f;
+                for(size_t i = 0; i < HotFieldCount; ++i)
+                {
+                    controller.Field(i) = controller.Field(i) * 0.99f + carry;
+                    carry = controller.Field(i) * 0.01f;
+                }
+            }
+            benchmark::ClobberMemory();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK_TEMPLATE(StepControllerLayout, ScatteredControllerLayout)->Arg(64)->Arg(1024)->Arg(8192);
+    BENCHMARK_TEMPLATE(StepControllerLayout, PackedControllerLayout)->Arg(64)->Arg(1024)->Arg(8192);
+#endif
+} // namespace UnitTest
 
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -2,4 +2,8 @@
 set(FILES
     Include/FirstPersonController/FirstPersonControllerBus.h
     Include/FirstPersonController/FirstPersonControllerComponentBus.h
+    Include/FirstPersonController/FirstPersonControllerImpact.h
+    Include/FirstPersonController/FirstPersonControllerJumpPrediction.h
+    Include/FirstPersonController/FirstPersonControllerMovementProfile.h
+    Include/FirstPersonController/FirstPersonControllerState.h
 )
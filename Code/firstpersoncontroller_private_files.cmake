@@ -5,4 +5,7 @@ set(FILES
     Source/Clients/FirstPersonControllerSystemComponent.h
     Source/Clients/FirstPersonControllerComponent.cpp
     Source/Clients/FirstPersonControllerComponent.h
+    Source/Clients/FirstPersonControllerCommandQueue.h
+    Source/Clients/FirstPersonControllerVelocityKernel.h
+    Source/Clients/FirstPersonControllerVerticalMotion.h
 )